@@ -36,8 +36,22 @@ void Board320_240::initBoard() {
   if (psramFound())
     psramUsed = true;
 #endif
+#if STRIP_LINES > 0
+  // 16bpp band of STRIP_LINES without psram
+  this->stripLines = (psramUsed) ? 0 : STRIP_LINES;
+  this->spr.setColorDepth(16);
+  this->spr.createSprite(320, (psramUsed) ? 240 : STRIP_LINES);
+#else
   this->spr.setColorDepth((psramUsed) ? 16 : 8);
   this->spr.createSprite(320, 240);
+#endif
+  // HUD digits (font 8), 1bpp white on black
+  this->hudBigSpr.setColorDepth(1);
+  this->hudBigSpr.createSprite(240, HUD_BIG_LINES);
+  this->hudBigSpr.setBitmapColor(TFT_WHITE, TFT_BLACK);
+  this->hudSmallSpr.setColorDepth(1);
+  this->hudSmallSpr.createSprite(240, HUD_SMALL_LINES);
+  this->hudSmallSpr.setBitmapColor(TFT_WHITE, TFT_BLACK);
 }
 
 /**
@@ -65,6 +79,8 @@ void Board320_240::setBrightness(byte lcdBrightnessPerc) {
 void Board320_240::displayMessage(const char* row1, const char* row2) {
 
   // Must draw directly, withou sprite (due to psramFound check)
+  this->drawnScreen = SCREEN_BLANK;
+  this->hudDrawn = false;
   this->tft.fillScreen(TFT_BLACK);
   this->tft.setTextDatum(ML_DATUM);
   this->tft.setTextColor(TFT_WHITE, TFT_BLACK);
@@ -74,12 +90,252 @@ void Board320_240::displayMessage(const char* row1, const char* row2) {
   this->tft.drawString(row2, 0, (240 / 2) + 30, GFXFF);
 }
 
+/**
+  FNV-1a hash of cell text
+*/
+uint32_t Board320_240::hashText(uint32_t hash, const char* text) {
+
+  hash ^= 2166136261UL;
+  while (*text) {
+    hash ^= (uint8_t) * text++;
+    hash *= 16777619UL;
+  }
+  return hash * 16777619UL;
+}
+
+/**
+  Check if cell content changed since last frame, changed cell is pushed to display as dirty rect
+*/
+bool Board320_240::isCellDirty(uint8_t cell, uint32_t hash, int32_t x, int32_t y, int32_t w, int32_t h) {
+
+  if (cell < CELL_CACHE_SIZE) {
+    if (!this->fullRedraw && this->cellCache[cell] == hash)
+      return false;
+    this->cellCache[cell] = hash;
+  }
+
+  if (!this->fullRedraw) {
+    if (this->dirtyRectsCount >= DIRTY_RECTS_SIZE) {
+      // Too many changes, push whole sprite
+      this->fullRedraw = true;
+    } else {
+      this->dirtyRects[this->dirtyRectsCount] = {(int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h};
+      this->dirtyRectsCount++;
+    }
+  }
+
+  return true;
+}
+
+/**
+  Format number with fixed decimals (0..3) into buf, prefix/suffix added, intDigits - zero padding
+  Digits and sign as printf("%.*f") incl. negative value rounded to zero (-0.0)
+  Values beyond +-999999 and NaN are printed as "-" (number fits screen buffers)
+  Returns end of string (next number can be appended)
+*/
+char* Board320_240::formatNumber(char* buf, float value, uint8_t decimals, const char* prefix, const char* suffix, uint8_t intDigits) {
+
+  static const uint16_t pow10[] = {1, 10, 100, 1000};
+  char digits[8];
+  uint8_t count = 0;
+
+  while (*prefix)
+    *buf++ = *prefix++;
+
+  if (decimals > 3)
+    decimals = 3;
+  if (isnan(value) || value > 999999.0 || value < -999999.0) {
+    *buf++ = '-';
+  } else {
+    bool negative = signbit(value);
+    // Round half to even as printf (product is exact in double)
+    double exact = (negative ? -(double)value : (double)value) * pow10[decimals];
+    uint32_t scaled = exact;
+    if (exact - scaled > 0.5 || (exact - scaled == 0.5 && (scaled & 1)))
+      scaled++;
+    uint32_t intPart = scaled / pow10[decimals];
+    uint32_t fracPart = scaled % pow10[decimals];
+    if (negative) {
+      *buf++ = '-';
+      if (intDigits > 1)
+        intDigits--; // sign is part of width
+    }
+    do {
+      digits[count++] = '0' + (intPart % 10);
+      intPart /= 10;
+    } while (intPart != 0);
+    while (count < intDigits && count < sizeof(digits))
+      digits[count++] = '0';
+    while (count > 0)
+      *buf++ = digits[--count];
+    if (decimals > 0) {
+      *buf++ = '.';
+      for (uint8_t i = decimals; i > 0; i--) {
+        buf[i - 1] = '0' + (fracPart % 10);
+        fracPart /= 10;
+      }
+      buf += decimals;
+    }
+  }
+
+  while (*suffix)
+    *buf++ = *suffix++;
+  *buf = 0;
+
+  return buf;
+}
+
+/**
+  Format temperature in units by settings (C without decimals, F with 1 decimal), unit letter added after separator (NULL - no unit)
+*/
+char* Board320_240::formatTemperature(char* buf, float celsius, const char* prefix, const char* unitSeparator) {
+
+  bool celsiusUnit = (this->liveData->settings.temperatureUnit == 'c');
+  buf = this->formatNumber(buf, this->liveData->celsius2temperature(celsius), (celsiusUnit ? 0 : 1), prefix);
+  if (unitSeparator != NULL) {
+    while (*unitSeparator)
+      *buf++ = *unitSeparator++;
+    *buf++ = (celsiusUnit ? 'C' : 'F');
+    *buf = 0;
+  }
+
+  return buf;
+}
+
+/**
+  Glyph runs of font/size, rasterized once on first use
+*/
+GLYPH_FONT* Board320_240::glyphFont(uint8_t font, uint8_t size) {
+
+  for (uint8_t i = 0; i < this->glyphFontsCount; i++)
+    if (this->glyphFonts[i].font == font && this->glyphFonts[i].size == size)
+      return (this->glyphFonts[i].runs == NULL) ? NULL : &this->glyphFonts[i];
+  if (this->glyphFontsCount >= GLYPH_CACHE_FONTS)
+    return NULL;
+
+  GLYPH_FONT* glyphFont = &this->glyphFonts[this->glyphFontsCount++];
+  const char* chars = GLYPH_CACHE_CHARS;
+  char ch[2] = {0, 0};
+  uint16_t runsCount = 0;
+  uint8_t pass, i;
+  int32_t x, y, runX;
+
+  glyphFont->font = font;
+  glyphFont->size = size;
+  glyphFont->runs = NULL;
+
+  // Rasterize each character into 1bpp sprite, scan runs (pass 0 count, pass 1 store)
+  TFT_eSprite glyphSpr = TFT_eSprite(&tft);
+  glyphSpr.setColorDepth(1);
+  glyphSpr.setTextSize(size);
+  glyphFont->height = glyphSpr.fontHeight(font);
+  glyphSpr.createSprite(glyphSpr.textWidth("0", font) * 2, glyphFont->height);
+  glyphSpr.setTextDatum(TL_DATUM);
+  glyphSpr.setTextColor(TFT_WHITE, TFT_BLACK);
+
+  for (pass = 0; pass < 2; pass++) {
+    if (pass == 1) {
+      glyphFont->runs = (GLYPH_RUN*)malloc((runsCount == 0 ? 1 : runsCount) * sizeof(GLYPH_RUN));
+      if (glyphFont->runs == NULL)
+        break;
+      runsCount = 0;
+    }
+    for (i = 0; i < GLYPH_CACHE_CHARS_COUNT; i++) {
+      ch[0] = chars[i];
+      glyphFont->glyphs[i].width = glyphSpr.textWidth(ch, font);
+      glyphFont->glyphs[i].runsFrom = runsCount;
+      glyphSpr.fillSprite(TFT_BLACK);
+      glyphSpr.drawString(ch, 0, 0, font);
+      for (y = 0; y < glyphFont->height; y++) {
+        runX = -1;
+        for (x = 0; x <= glyphFont->glyphs[i].width; x++) {
+          bool fg = (x < glyphFont->glyphs[i].width && glyphSpr.readPixel(x, y) != 0);
+          if (fg && runX == -1) {
+            runX = x;
+          } else if (!fg && runX != -1) {
+            if (pass == 1) {
+              glyphFont->runs[runsCount].y = y;
+              glyphFont->runs[runsCount].x = runX;
+              glyphFont->runs[runsCount].len = x - runX;
+            }
+            runsCount++;
+            runX = -1;
+          }
+        }
+      }
+      glyphFont->glyphs[i].runsCount = runsCount - glyphFont->glyphs[i].runsFrom;
+    }
+  }
+
+  glyphSpr.deleteSprite();
+
+  return (glyphFont->runs == NULL) ? NULL : glyphFont;
+}
+
+/**
+  Draw digits of font 7/8 from glyph cache (foreground only, background is already filled)
+  Returns false if text contains not cached character, caller draws by library
+*/
+bool Board320_240::drawCachedString(TFT_eSprite& target, const char* text, int32_t x, int32_t y, uint8_t font, uint8_t size, uint8_t datum, uint16_t color) {
+
+  const char* chars = GLYPH_CACHE_CHARS;
+  uint8_t indexes[20];
+  uint8_t count = 0;
+  int32_t width = 0;
+
+  GLYPH_FONT* glyphFont = this->glyphFont(font, size);
+  if (glyphFont == NULL)
+    return false;
+
+  for (const char* c = text; *c; c++) {
+    const char* pos = strchr(chars, *c);
+    if (pos == NULL || count >= sizeof(indexes))
+      return false;
+    indexes[count++] = pos - chars;
+    width += glyphFont->glyphs[pos - chars].width;
+  }
+
+  switch (datum) {
+    case TL_DATUM: break;
+    case TR_DATUM: x -= width; break;
+    case MC_DATUM: x -= width / 2; y -= glyphFont->height / 2; break;
+    default: return false;
+  }
+
+  for (uint8_t i = 0; i < count; i++) {
+    GLYPH* glyph = &glyphFont->glyphs[indexes[i]];
+    GLYPH_RUN* run = &glyphFont->runs[glyph->runsFrom];
+    for (uint16_t j = 0; j < glyph->runsCount; j++, run++)
+      target.drawFastHLine(x + run->x, y + run->y, run->len, color);
+    x += glyph->width;
+  }
+
+  return true;
+}
+
 /**
   Draw cell on dashboard
 */
 void Board320_240::drawBigCell(int32_t x, int32_t y, int32_t w, int32_t h, const char* text, const char* desc, uint16_t bgColor, uint16_t fgColor) {
 
   int32_t posx, posy;
+  char dischargedStr[16], chargedStr[16];
+
+  // Big 2x2 cell shows charged/discharged kWh from start
+  if (w == 2 && h == 2) {
+    this->formatNumber(dischargedStr, this->params.cumulativeEnergyDischargedKWh - this->params.cumulativeEnergyDischargedKWhStart, 1, "-");
+    this->formatNumber(chargedStr, this->params.cumulativeEnergyChargedKWh - this->params.cumulativeEnergyChargedKWhStart, 1, "+");
+  } else {
+    dischargedStr[0] = chargedStr[0] = 0;
+  }
+
+  // Skip unchanged cell
+  uint32_t hash = this->hashText(((uint32_t)bgColor << 16) | fgColor, text);
+  hash = this->hashText(hash, desc);
+  hash = this->hashText(hash, dischargedStr);
+  hash = this->hashText(hash, chargedStr);
+  if (!this->isCellDirty((y * 4) + x, hash, x * 80, y * 60, w * 80, h * 60))
+    return;
 
   posx = (x * 80) + 4;
   posy = (y * 60) + 1;
@@ -98,21 +354,20 @@ void Board320_240::drawBigCell(int32_t x, int32_t y, int32_t w, int32_t h, const
     // Bottom 2 numbers with charged/discharged kWh from start
     posx = (x * 80) + 5;
     posy = ((y + h) * 60) - 32;
-    sprintf(this->tmpStr3, "-%01.01f", this->liveData->params.cumulativeEnergyDischargedKWh - this->liveData->params.cumulativeEnergyDischargedKWhStart);
     this->spr.setFreeFont(&Roboto_Thin_24);
     this->spr.setTextDatum(TL_DATUM);
-    this->spr.drawString(this->tmpStr3, posx, posy, GFXFF);
+    this->spr.drawString(dischargedStr, posx, posy, GFXFF);
 
     posx = ((x + w) * 80) - 8;
-    sprintf(this->tmpStr3, "+%01.01f", this->liveData->params.cumulativeEnergyChargedKWh - this->liveData->params.cumulativeEnergyChargedKWhStart);
     this->spr.setTextDatum(TR_DATUM);
-    this->spr.drawString(this->tmpStr3, posx, posy, GFXFF);
+    this->spr.drawString(chargedStr, posx, posy, GFXFF);
 
     // Main number - kwh on roads, amps on charges
     posy = (y * 60) + 24;
     this->spr.setTextColor(fgColor, bgColor);
     this->spr.setFreeFont(&Orbitron_Light_32);
-    this->spr.drawString(text, posx, posy, 7);
+    if (!this->drawCachedString(this->spr, text, posx, posy, 7, 1, TR_DATUM, fgColor))
+      this->spr.drawString(text, posx, posy, 7);
 
   } else {
 
@@ -122,7 +377,8 @@ void Board320_240::drawBigCell(int32_t x, int32_t y, int32_t w, int32_t h, const
     this->spr.setFreeFont(&Orbitron_Light_24);
     posx = (x * 80) + (w * 80 / 2) - 3;
     posy = (y * 60) + (h * 60 / 2) + 4;
-    this->spr.drawString(text, posx, posy, (w == 2 ? 7 : GFXFF));
+    if (w != 2 || !this->drawCachedString(this->spr, text, posx, posy, 7, 1, MC_DATUM, fgColor))
+      this->spr.drawString(text, posx, posy, (w == 2 ? 7 : GFXFF));
   }
 }
 
@@ -133,6 +389,12 @@ void Board320_240::drawSmallCell(int32_t x, int32_t y, int32_t w, int32_t h, con
 
   int32_t posx, posy;
 
+  // Skip unchanged cell
+  uint32_t hash = this->hashText(((uint32_t)(uint16_t)bgColor << 16) | (uint16_t)fgColor, text);
+  hash = this->hashText(hash, desc);
+  if (!this->isCellDirty(CELL_SMALL_OFFSET + (y * 4) + x, hash, x * 80, y * 32, w * 80, h * 32))
+    return;
+
   posx = (x * 80) + 4;
   posy = (y * 32) + 1;
 
@@ -191,77 +453,110 @@ void Board320_240::drawSceneMain() {
     strcpy(pressureStr, "psi");
   if (this->liveData->settings.temperatureUnit != 'c')
     strcpy(temperatureStr, "F");
-  sprintf(this->tmpStr1, "%01.01f%s %02.00f%s", this->liveData->bar2pressure(this->liveData->params.tireFrontLeftPressureBar), pressureStr, this->liveData->celsius2temperature(this->liveData->params.tireFrontLeftTempC), temperatureStr);
-  sprintf(this->tmpStr2, "%02.00f%s %01.01f%s", this->liveData->celsius2temperature(this->liveData->params.tireFrontRightTempC), temperatureStr, this->liveData->bar2pressure(this->liveData->params.tireFrontRightPressureBar), pressureStr);
-  sprintf(this->tmpStr3, "%01.01f%s %02.00f%s", this->liveData->bar2pressure(this->liveData->params.tireRearLeftPressureBar), pressureStr, this->liveData->celsius2temperature(this->liveData->params.tireRearLeftTempC), temperatureStr);
-  sprintf(this->tmpStr4, "%02.00f%s %01.01f%s", this->liveData->celsius2temperature(this->liveData->params.tireRearRightTempC), temperatureStr, this->liveData->bar2pressure(this->liveData->params.tireRearRightPressureBar), pressureStr);
-  showTires(1, 0, 2, 1, this->tmpStr1, this->tmpStr2, this->tmpStr3, this->tmpStr4, TFT_BLACK);
+  this->formatNumber(this->formatNumber(this->tmpStr1, this->liveData->bar2pressure(this->params.tireFrontLeftPressureBar), 1, "", pressureStr), this->liveData->celsius2temperature(this->params.tireFrontLeftTempC), 0, " ", temperatureStr, 2);
+  this->formatNumber(this->formatNumber(this->tmpStr2, this->liveData->celsius2temperature(this->params.tireFrontRightTempC), 0, "", temperatureStr, 2), this->liveData->bar2pressure(this->params.tireFrontRightPressureBar), 1, " ", pressureStr);
+  this->formatNumber(this->formatNumber(this->tmpStr3, this->liveData->bar2pressure(this->params.tireRearLeftPressureBar), 1, "", pressureStr), this->liveData->celsius2temperature(this->params.tireRearLeftTempC), 0, " ", temperatureStr, 2);
+  this->formatNumber(this->formatNumber(this->tmpStr4, this->liveData->celsius2temperature(this->params.tireRearRightTempC), 0, "", temperatureStr, 2), this->liveData->bar2pressure(this->params.tireRearRightPressureBar), 1, " ", pressureStr);
 
   // Added later - kwh total in tires box
   // TODO: refactoring
-  this->spr.setTextDatum(TL_DATUM);
-  this->spr.setTextColor(TFT_GREEN, TFT_BLACK);
-  sprintf(this->tmpStr1, "C: %01.01f +%01.01fkWh", this->liveData->params.cumulativeEnergyChargedKWh, this->liveData->params.cumulativeEnergyChargedKWh - this->liveData->params.cumulativeEnergyChargedKWhStart);
-  this->spr.drawString(this->tmpStr1, (1 * 80) + 4, (0 * 60) + 30, 2);
-  this->spr.setTextColor(TFT_YELLOW, TFT_BLACK);
-  sprintf(this->tmpStr1, "D: %01.01f -%01.01fkWh", this->liveData->params.cumulativeEnergyDischargedKWh, this->liveData->params.cumulativeEnergyDischargedKWh - this->liveData->params.cumulativeEnergyDischargedKWhStart);
-  this->spr.drawString(this->tmpStr1, (1 * 80) + 4, (0 * 60) + 44, 2);
+  char chargedStr[32], dischargedStr[32];
+  this->formatNumber(this->formatNumber(chargedStr, this->params.cumulativeEnergyChargedKWh, 1, "C: ", " +"), this->params.cumulativeEnergyChargedKWh - this->params.cumulativeEnergyChargedKWhStart, 1, "", "kWh");
+  this->formatNumber(this->formatNumber(dischargedStr, this->params.cumulativeEnergyDischargedKWh, 1, "D: ", " -"), this->params.cumulativeEnergyDischargedKWh - this->params.cumulativeEnergyDischargedKWhStart, 1, "", "kWh");
+
+  // Tires box (cell 1,0 2x1)
+  uint32_t hash = this->hashText(0, this->tmpStr1);
+  hash = this->hashText(hash, this->tmpStr2);
+  hash = this->hashText(hash, this->tmpStr3);
+  hash = this->hashText(hash, this->tmpStr4);
+  hash = this->hashText(hash, chargedStr);
+  hash = this->hashText(hash, dischargedStr);
+  if (this->isCellDirty(1, hash, 1 * 80, 0, 2 * 80, 60)) {
+    this->spr.fillRect(1 * 80, 0, (2 * 80) - 1, 60 - 1, TFT_BLACK);
+    showTires(1, 0, 2, 1, this->tmpStr1, this->tmpStr2, this->tmpStr3, this->tmpStr4, TFT_BLACK);
+    this->spr.setTextDatum(TL_DATUM);
+    this->spr.setTextColor(TFT_GREEN, TFT_BLACK);
+    this->spr.drawString(chargedStr, (1 * 80) + 4, (0 * 60) + 30, 2);
+    this->spr.setTextColor(TFT_YELLOW, TFT_BLACK);
+    this->spr.drawString(dischargedStr, (1 * 80) + 4, (0 * 60) + 44, 2);
+  }
 
   // batPowerKwh100 on roads, else batPowerAmp
-  if (this->liveData->params.speedKmh > 20) {
-    sprintf(this->tmpStr1, "%01.01f", this->liveData->km2distance(this->liveData->params.batPowerKwh100));
-    drawBigCell(1, 1, 2, 2, this->tmpStr1, ((this->liveData->settings.distanceUnit == 'k') ? "POWER KWH/100KM" : "POWER KWH/100MI"), (this->liveData->params.batPowerKwh100 >= 0 ? TFT_DARKGREEN2 : (this->liveData->params.batPowerKwh100 < -30.0 ? TFT_RED : TFT_DARKRED)), TFT_WHITE);
+  if (this->params.speedKmh > 20) {
+    this->formatNumber(this->tmpStr1, this->liveData->km2distance(this->params.batPowerKwh100), 1);
+    drawBigCell(1, 1, 2, 2, this->tmpStr1, ((this->liveData->settings.distanceUnit == 'k') ? "POWER KWH/100KM" : "POWER KWH/100MI"), (this->params.batPowerKwh100 >= 0 ? TFT_DARKGREEN2 : (this->params.batPowerKwh100 < -30.0 ? TFT_RED : TFT_DARKRED)), TFT_WHITE);
   } else {
     // batPowerAmp on chargers (under 10kmh)
-    sprintf(this->tmpStr1, "%01.01f", this->liveData->params.batPowerKw);
-    drawBigCell(1, 1, 2, 2, this->tmpStr1, "POWER KW", (this->liveData->params.batPowerKw >= 0 ? TFT_DARKGREEN2 : (this->liveData->params.batPowerKw <= -30 ? TFT_RED : TFT_DARKRED)), TFT_WHITE);
+    this->formatNumber(this->tmpStr1, this->params.batPowerKw, 1);
+    drawBigCell(1, 1, 2, 2, this->tmpStr1, "POWER KW", (this->params.batPowerKw >= 0 ? TFT_DARKGREEN2 : (this->params.batPowerKw <= -30 ? TFT_RED : TFT_DARKRED)), TFT_WHITE);
   }
 
   // socPerc
-  sprintf(this->tmpStr1, "%01.00f%%", this->liveData->params.socPerc);
-  sprintf(this->tmpStr2, (this->liveData->params.sohPerc ==  100.0 ? "SOC/H%01.00f%%" : "SOC/H%01.01f%%"), this->liveData->params.sohPerc);
-  drawBigCell(0, 0, 1, 1, this->tmpStr1, this->tmpStr2, (this->liveData->params.socPerc < 10 || this->liveData->params.sohPerc < 100 ? TFT_RED : (this->liveData->params.socPerc  > 80 ? TFT_DARKGREEN2 : TFT_DEFAULT_BK)), TFT_WHITE);
+  this->formatNumber(this->tmpStr1, this->params.socPerc, 0, "", "%");
+  this->formatNumber(this->tmpStr2, this->params.sohPerc, (this->params.sohPerc ==  100.0 ? 0 : 1), "SOC/H", "%");
+  drawBigCell(0, 0, 1, 1, this->tmpStr1, this->tmpStr2, (this->params.socPerc < 10 || this->params.sohPerc < 100 ? TFT_RED : (this->params.socPerc  > 80 ? TFT_DARKGREEN2 : TFT_DEFAULT_BK)), TFT_WHITE);
 
   // batPowerAmp
-  sprintf(this->tmpStr1, (abs(this->liveData->params.batPowerAmp) > 9.9 ? "%01.00f" : "%01.01f"), this->liveData->params.batPowerAmp);
-  drawBigCell(0, 1, 1, 1, this->tmpStr1, "CURRENT A", (this->liveData->params.batPowerAmp >= 0 ? TFT_DARKGREEN2 : TFT_DARKRED), TFT_WHITE);
+  this->formatNumber(this->tmpStr1, this->params.batPowerAmp, (abs(this->params.batPowerAmp) > 9.9 ? 0 : 1));
+  drawBigCell(0, 1, 1, 1, this->tmpStr1, "CURRENT A", (this->params.batPowerAmp >= 0 ? TFT_DARKGREEN2 : TFT_DARKRED), TFT_WHITE);
 
   // batVoltage
-  sprintf(this->tmpStr1, "%03.00f", this->liveData->params.batVoltage);
+  this->formatNumber(this->tmpStr1, this->params.batVoltage, 0, "", "", 3);
   drawBigCell(0, 2, 1, 1, this->tmpStr1, "VOLTAGE", TFT_DEFAULT_BK, TFT_WHITE);
 
   // batCellMinV
-  sprintf(this->tmpStr1, "%01.02f", this->liveData->params.batCellMaxV - this->liveData->params.batCellMinV);
-  sprintf(this->tmpStr2, "CELLS %01.02f", this->liveData->params.batCellMinV);
-  drawBigCell(0, 3, 1, 1, ( this->liveData->params.batCellMaxV - this->liveData->params.batCellMinV == 0.00 ? "OK" : this->tmpStr1), this->tmpStr2, TFT_DEFAULT_BK, TFT_WHITE);
+  this->formatNumber(this->tmpStr1, this->params.batCellMaxV - this->params.batCellMinV, 2);
+  this->formatNumber(this->tmpStr2, this->params.batCellMinV, 2, "CELLS ");
+  drawBigCell(0, 3, 1, 1, ( this->params.batCellMaxV - this->params.batCellMinV == 0.00 ? "OK" : this->tmpStr1), this->tmpStr2, TFT_DEFAULT_BK, TFT_WHITE);
 
   // batTempC
-  sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "%01.00f" : "%01.01f"), this->liveData->celsius2temperature(this->liveData->params.batMinC));
-  sprintf(this->tmpStr2, ((this->liveData->settings.temperatureUnit == 'c') ? "BATT. %01.00fC" : "BATT. %01.01fF"), this->liveData->celsius2temperature(this->liveData->params.batMaxC));
-  drawBigCell(1, 3, 1, 1, this->tmpStr1, this->tmpStr2, TFT_TEMP, (this->liveData->params.batTempC >= 15) ? ((this->liveData->params.batTempC >= 25) ? TFT_GREEN : TFT_BLUE) : TFT_RED);
+  this->formatTemperature(this->tmpStr1, this->params.batMinC);
+  this->formatTemperature(this->tmpStr2, this->params.batMaxC, "BATT. ", "");
+  drawBigCell(1, 3, 1, 1, this->tmpStr1, this->tmpStr2, TFT_TEMP, (this->params.batTempC >= 15) ? ((this->params.batTempC >= 25) ? TFT_GREEN : TFT_BLUE) : TFT_RED);
 
   // batHeaterC
-  sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "%01.00f" : "%01.01f"), this->liveData->celsius2temperature(this->liveData->params.batHeaterC));
+  this->formatTemperature(this->tmpStr1, this->params.batHeaterC);
   drawBigCell(2, 3, 1, 1, this->tmpStr1, "BAT.HEAT", TFT_TEMP, TFT_WHITE);
 
   // Aux perc
-  sprintf(this->tmpStr1, "%01.00f%%", this->liveData->params.auxPerc);
-  drawBigCell(3, 0, 1, 1, this->tmpStr1, "AUX BAT.", (this->liveData->params.auxPerc < 60 ? TFT_RED : TFT_DEFAULT_BK), TFT_WHITE);
+  this->formatNumber(this->tmpStr1, this->params.auxPerc, 0, "", "%");
+  drawBigCell(3, 0, 1, 1, this->tmpStr1, "AUX BAT.", (this->params.auxPerc < 60 ? TFT_RED : TFT_DEFAULT_BK), TFT_WHITE);
 
   // Aux amp
-  sprintf(this->tmpStr1, (abs(this->liveData->params.auxCurrentAmp) > 9.9 ? "%01.00f" : "%01.01f"), this->liveData->params.auxCurrentAmp);
-  drawBigCell(3, 1, 1, 1, this->tmpStr1, "AUX AMPS",  (this->liveData->params.auxCurrentAmp >= 0 ? TFT_DARKGREEN2 : TFT_DARKRED), TFT_WHITE);
+  this->formatNumber(this->tmpStr1, this->params.auxCurrentAmp, (abs(this->params.auxCurrentAmp) > 9.9 ? 0 : 1));
+  drawBigCell(3, 1, 1, 1, this->tmpStr1, "AUX AMPS",  (this->params.auxCurrentAmp >= 0 ? TFT_DARKGREEN2 : TFT_DARKRED), TFT_WHITE);
 
   // auxVoltage
-  sprintf(this->tmpStr1, "%01.01f", this->liveData->params.auxVoltage);
-  drawBigCell(3, 2, 1, 1, this->tmpStr1, "AUX VOLTS", (this->liveData->params.auxVoltage < 12.1 ? TFT_RED : (this->liveData->params.auxVoltage < 12.6 ? TFT_ORANGE : TFT_DEFAULT_BK)), TFT_WHITE);
+  this->formatNumber(this->tmpStr1, this->params.auxVoltage, 1);
+  drawBigCell(3, 2, 1, 1, this->tmpStr1, "AUX VOLTS", (this->params.auxVoltage < 12.1 ? TFT_RED : (this->params.auxVoltage < 12.6 ? TFT_ORANGE : TFT_DEFAULT_BK)), TFT_WHITE);
 
   // indoorTemperature
-  sprintf(this->tmpStr1, "%01.01f", this->liveData->celsius2temperature(this->liveData->params.indoorTemperature));
-  sprintf(this->tmpStr2, "IN/OUT%01.01f", this->liveData->celsius2temperature(this->liveData->params.outdoorTemperature));
+  this->formatNumber(this->tmpStr1, this->liveData->celsius2temperature(this->params.indoorTemperature), 1);
+  this->formatNumber(this->tmpStr2, this->liveData->celsius2temperature(this->params.outdoorTemperature), 1, "IN/OUT");
   drawBigCell(3, 3, 1, 1, this->tmpStr1, this->tmpStr2, TFT_TEMP, TFT_WHITE);
 }
 
+/**
+  Draw HUD value into 1bpp region sprite, push to display only if text changed
+*/
+bool Board320_240::drawHudRegion(uint8_t region, TFT_eSprite& regionSpr, const char* text, uint8_t textSize, int32_t posY) {
+
+  uint32_t hash = this->hashText(textSize, text);
+  if (this->hudCache[region] == hash)
+    return false;
+  this->hudCache[region] = hash;
+
+  regionSpr.fillSprite(TFT_BLACK);
+  regionSpr.setTextDatum(TR_DATUM); // top-right alignment
+  regionSpr.setTextColor(TFT_WHITE, TFT_BLACK); // foreground, background text color
+  regionSpr.setTextSize(textSize);
+  if (!this->drawCachedString(regionSpr, text, 240, 0, 8, textSize, TR_DATUM, TFT_WHITE))
+    regionSpr.drawString(text, 240, 0, 8);
+  regionSpr.pushSprite(0, posY);
+
+  return true;
+}
+
 /**
    Speed + kwh/100km (Screen 2)
 */
@@ -272,39 +567,46 @@ void Board320_240::drawSceneSpeed() {
   // HUD
   if (this->displayScreenSpeedHud) {
 
-    // Change rotation to vertical & mirror
-    if (this->tft.getRotation() != 6) {
+    // Change rotation to vertical & mirror, panel does mirrored blit of region sprites
+    if (this->tft.getRotation() != 6 || !this->hudDrawn) {
       this->tft.setRotation(6);
+      this->tft.fillScreen(TFT_BLACK);
+      for (uint8_t i = 0; i < HUD_CACHE_SIZE; i++)
+        this->hudCache[i] = 0;
+      this->hudDrawn = true;
     }
 
-    this->tft.fillScreen(TFT_BLACK);
-    this->tft.setTextDatum(TR_DATUM); // top-right alignment
-    this->tft.setTextColor(TFT_WHITE, TFT_BLACK); // foreground, background text color
-
     // Draw speed
-    this->tft.setTextSize((this->liveData->params.speedKmh > 99) ? 1 : 2);
     sprintf(this->tmpStr3, "0");
-    if (this->liveData->params.speedKmh > 10)
-      sprintf(this->tmpStr3, "%01.00f", this->liveData->km2distance(this->liveData->params.speedKmh));
-    this->tft.drawString(this->tmpStr3, 240, 0, 8);
+    if (this->params.speedKmh > 10)
+      this->formatNumber(this->tmpStr3, this->liveData->km2distance(this->params.speedKmh), 0);
+    this->drawHudRegion(0, this->hudBigSpr, this->tmpStr3, (this->params.speedKmh > 99) ? 1 : 2, 0);
 
     // Draw power kWh/100km (>25kmh) else kW
-    this->tft.setTextSize(1);
-    if (this->liveData->params.speedKmh > 25 && this->liveData->params.batPowerKw < 0)
-      sprintf(this->tmpStr3, "%01.01f", this->liveData->km2distance(this->liveData->params.batPowerKwh100));
+    if (this->params.speedKmh > 25 && this->params.batPowerKw < 0)
+      this->formatNumber(this->tmpStr3, this->liveData->km2distance(this->params.batPowerKwh100), 1);
     else
-      sprintf(this->tmpStr3, "%01.01f", this->liveData->params.batPowerKw);
-    this->tft.drawString(this->tmpStr3, 240, 150, 8);
+      this->formatNumber(this->tmpStr3, this->params.batPowerKw, 1);
+    this->drawHudRegion(1, this->hudSmallSpr, this->tmpStr3, 1, 150);
 
     // Draw soc%
-    sprintf(this->tmpStr3, "%01.00f", this->liveData->params.socPerc);
-    this->tft.drawString(this->tmpStr3, 240 , 230, 8);
+    this->formatNumber(this->tmpStr3, this->params.socPerc, 0);
+    if (this->drawHudRegion(2, this->hudSmallSpr, this->tmpStr3, 1, 230))
+      this->hudCache[3] = 0; // soc region covers circle
 
     // Cold gate cirlce
-    this->tft.fillCircle(30, 280, 25, (this->liveData->params.batTempC >= 15) ? ((this->liveData->params.batTempC >= 25) ? TFT_DARKGREEN2 : TFT_BLUE) : TFT_RED);
+    uint16_t color = (this->params.batTempC >= 15) ? ((this->params.batTempC >= 25) ? TFT_DARKGREEN2 : TFT_BLUE) : TFT_RED;
+    if (this->hudCache[3] != color + 1U) {
+      this->hudCache[3] = color + 1U;
+      this->tft.fillCircle(30, 280, 25, color);
+    }
 
     // Brake lights
-    this->tft.fillRect(0, 310, 240, 10, (this->liveData->params.brakeLights) ? TFT_RED : TFT_BLACK);
+    color = (this->params.brakeLights) ? TFT_RED : TFT_BLACK;
+    if (this->hudCache[4] != color + 1U) {
+      this->hudCache[4] = color + 1U;
+      this->tft.fillRect(0, 310, 240, 10, color);
+    }
 
     return;
   }
@@ -318,19 +620,21 @@ void Board320_240::drawSceneSpeed() {
   this->spr.setTextColor(TFT_WHITE, TFT_DARKRED);
   this->spr.setTextSize(2); // Size for small 5cix7 font
   sprintf(this->tmpStr3, "0");
-  if (this->liveData->params.speedKmh > 10)
-    sprintf(this->tmpStr3, "%01.00f", this->liveData->km2distance(this->liveData->params.speedKmh));
-  this->spr.drawString(this->tmpStr3, 200, posy, 7);
+  if (this->params.speedKmh > 10)
+    this->formatNumber(this->tmpStr3, this->liveData->km2distance(this->params.speedKmh), 0);
+  if (!this->drawCachedString(this->spr, this->tmpStr3, 200, posy, 7, 2, TR_DATUM, TFT_WHITE))
+    this->spr.drawString(this->tmpStr3, 200, posy, 7);
 
   posy = 145;
   this->spr.setTextDatum(TR_DATUM); // Top center
   this->spr.setTextSize(1);
-  if (this->liveData->params.speedKmh > 25 && this->liveData->params.batPowerKw < 0) {
-    sprintf(this->tmpStr3, "%01.01f", this->liveData->km2distance(this->liveData->params.batPowerKwh100));
+  if (this->params.speedKmh > 25 && this->params.batPowerKw < 0) {
+    this->formatNumber(this->tmpStr3, this->liveData->km2distance(this->params.batPowerKwh100), 1);
   } else {
-    sprintf(this->tmpStr3, "%01.01f", this->liveData->params.batPowerKw);
+    this->formatNumber(this->tmpStr3, this->params.batPowerKw, 1);
   }
-  this->spr.drawString(this->tmpStr3, 200, posy, 7);
+  if (!this->drawCachedString(this->spr, this->tmpStr3, 200, posy, 7, 1, TR_DATUM, TFT_WHITE))
+    this->spr.drawString(this->tmpStr3, 200, posy, 7);
 
   // Bottom 2 numbers with charged/discharged kWh from start
   this->spr.setFreeFont(&Roboto_Thin_24);
@@ -338,54 +642,54 @@ void Board320_240::drawSceneSpeed() {
   posx = 5;
   posy = 5;
   this->spr.setTextDatum(TL_DATUM);
-  sprintf(this->tmpStr3, ((this->liveData->settings.distanceUnit == 'k') ? "%01.00fkm  " : "%01.00fmi  "), this->liveData->km2distance(this->liveData->params.odoKm));
+  this->formatNumber(this->tmpStr3, this->liveData->km2distance(this->params.odoKm), 0, "", ((this->liveData->settings.distanceUnit == 'k') ? "km  " : "mi  "));
   this->spr.drawString(this->tmpStr3, posx, posy, GFXFF);
-  if (this->liveData->params.motorRpm > -1) {
+  if (this->params.motorRpm > -1) {
     this->spr.setTextDatum(TR_DATUM);
-    sprintf(this->tmpStr3, "     %01.00frpm" , this->liveData->params.motorRpm);
+    this->formatNumber(this->tmpStr3, this->params.motorRpm, 0, "     ", "rpm");
     this->spr.drawString(this->tmpStr3, 320 - posx, posy, GFXFF);
   }
 
   // Bottom info
   // Cummulative regen/power
   posy = 240 - 5;
-  sprintf(this->tmpStr3, "-%01.01f    ", this->liveData->params.cumulativeEnergyDischargedKWh - this->liveData->params.cumulativeEnergyDischargedKWhStart);
+  this->formatNumber(this->tmpStr3, this->params.cumulativeEnergyDischargedKWh - this->params.cumulativeEnergyDischargedKWhStart, 1, "-", "    ");
   this->spr.setTextDatum(BL_DATUM);
   this->spr.drawString(this->tmpStr3, posx, posy, GFXFF);
   posx = 320 - 5;
-  sprintf(this->tmpStr3, "    +%01.01f", this->liveData->params.cumulativeEnergyChargedKWh - this->liveData->params.cumulativeEnergyChargedKWhStart);
+  this->formatNumber(this->tmpStr3, this->params.cumulativeEnergyChargedKWh - this->params.cumulativeEnergyChargedKWhStart, 1, "    +");
   this->spr.setTextDatum(BR_DATUM);
   this->spr.drawString(this->tmpStr3, posx, posy, GFXFF);
   // Bat.power
   posx = 320 / 2;
-  sprintf(this->tmpStr3, "   %01.01fkw   ", this->liveData->params.batPowerKw);
+  this->formatNumber(this->tmpStr3, this->params.batPowerKw, 1, "   ", "kw   ");
   this->spr.setTextDatum(BC_DATUM);
   this->spr.drawString(this->tmpStr3, posx, posy, GFXFF);
 
   // RIGHT INFO
   // Battery "cold gate" detection - red < 15C (43KW limit), <25 (blue - 55kW limit), green all ok
-  this->spr.fillCircle(290, 60, 25, (this->liveData->params.batTempC >= 15) ? ((this->liveData->params.batTempC >= 25) ? TFT_DARKGREEN2 : TFT_BLUE) : TFT_RED);
-  this->spr.setTextColor(TFT_WHITE, (this->liveData->params.batTempC >= 15) ? ((this->liveData->params.batTempC >= 25) ? TFT_DARKGREEN2 : TFT_BLUE) : TFT_RED);
+  this->spr.fillCircle(290, 60, 25, (this->params.batTempC >= 15) ? ((this->params.batTempC >= 25) ? TFT_DARKGREEN2 : TFT_BLUE) : TFT_RED);
+  this->spr.setTextColor(TFT_WHITE, (this->params.batTempC >= 15) ? ((this->params.batTempC >= 25) ? TFT_DARKGREEN2 : TFT_BLUE) : TFT_RED);
   this->spr.setFreeFont(&Roboto_Thin_24);
   this->spr.setTextDatum(MC_DATUM);
-  sprintf(this->tmpStr3, "%01.00f", this->liveData->celsius2temperature(this->liveData->params.batTempC));
+  this->formatNumber(this->tmpStr3, this->liveData->celsius2temperature(this->params.batTempC), 0);
   this->spr.drawString(this->tmpStr3, 290, 60, GFXFF);
   // Brake lights
-  this->spr.fillRect(210, 40, 40, 40, (this->liveData->params.brakeLights) ? TFT_RED : TFT_BLACK);
+  this->spr.fillRect(210, 40, 40, 40, (this->params.brakeLights) ? TFT_RED : TFT_BLACK);
 
   // Soc%, bat.kWh
   this->spr.setFreeFont(&Orbitron_Light_32);
   this->spr.setTextColor(TFT_WHITE, TFT_BLACK);
   this->spr.setTextDatum(TR_DATUM);
-  sprintf(this->tmpStr3, " %01.00f%%", this->liveData->params.socPerc);
+  this->formatNumber(this->tmpStr3, this->params.socPerc, 0, " ", "%");
   this->spr.drawString(this->tmpStr3, 320, 94, GFXFF);
-  if (this->liveData->params.socPerc > 0) {
-    float capacity = this->liveData->params.batteryTotalAvailableKWh * (this->liveData->params.socPerc / 100);
+  if (this->params.socPerc > 0) {
+    float capacity = this->params.batteryTotalAvailableKWh * (this->params.socPerc / 100);
     // calibration for Niro/Kona, real available capacity is ~66.5kWh, 0-10% ~6.2kWh, 90-100% ~7.2kWh
     if (this->liveData->settings.carType == CAR_KIA_ENIRO_2020_64 || this->liveData->settings.carType == CAR_HYUNDAI_KONA_2020_64) {
-      capacity = (this->liveData->params.socPerc * 0.615) * (1 + (this->liveData->params.socPerc * 0.0008));
+      capacity = (this->params.socPerc * 0.615) * (1 + (this->params.socPerc * 0.0008));
     }
-    sprintf(this->tmpStr3, " %01.01f", capacity);
+    this->formatNumber(this->tmpStr3, capacity, 1, " ");
     this->spr.drawString(this->tmpStr3, 320, 129, GFXFF);
     this->spr.drawString("kWh", 320, 164, GFXFF);
   }
@@ -398,57 +702,49 @@ void Board320_240::drawSceneBatteryCells() {
 
   int32_t posx, posy;
 
-  sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "%01.00f C" : "%01.01f F"), this->liveData->celsius2temperature(this->liveData->params.batHeaterC));
+  this->formatTemperature(this->tmpStr1, this->params.batHeaterC, "", " ");
   drawSmallCell(0, 0, 1, 1, this->tmpStr1, "HEATER", TFT_TEMP, TFT_CYAN);
-  sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "%01.00f C" : "%01.01f F"), this->liveData->celsius2temperature(this->liveData->params.batInletC));
+  this->formatTemperature(this->tmpStr1, this->params.batInletC, "", " ");
   drawSmallCell(1, 0, 1, 1, this->tmpStr1, "BAT.INLET", TFT_TEMP, TFT_CYAN);
-  sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "%01.00f C" : "%01.01f F"), this->liveData->celsius2temperature(this->liveData->params.batModuleTempC[0]));
-  drawSmallCell(0, 1, 1, 1, this->tmpStr1, "MO1", TFT_TEMP, (this->liveData->params.batModuleTempC[0] >= 15) ? ((this->liveData->params.batModuleTempC[0] >= 25) ? TFT_GREEN : TFT_BLUE) : TFT_RED);
-  sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "%01.00f C" : "%01.01f F"), this->liveData->celsius2temperature(this->liveData->params.batModuleTempC[1]));
-  drawSmallCell(1, 1, 1, 1, this->tmpStr1, "MO2", TFT_TEMP, (this->liveData->params.batModuleTempC[1] >= 15) ? ((this->liveData->params.batModuleTempC[1] >= 25) ? TFT_GREEN : TFT_BLUE) : TFT_RED);
-  sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "%01.00f C" : "%01.01f F"), this->liveData->celsius2temperature(this->liveData->params.batModuleTempC[2]));
-  drawSmallCell(2, 1, 1, 1, this->tmpStr1, "MO3", TFT_TEMP, (this->liveData->params.batModuleTempC[2] >= 15) ? ((this->liveData->params.batModuleTempC[2] >= 25) ? TFT_GREEN : TFT_BLUE) : TFT_RED);
-  sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "%01.00f C" : "%01.01f F"), this->liveData->celsius2temperature(this->liveData->params.batModuleTempC[3]));
-  drawSmallCell(3, 1, 1, 1, this->tmpStr1, "MO4", TFT_TEMP, (this->liveData->params.batModuleTempC[3] >= 15) ? ((this->liveData->params.batModuleTempC[3] >= 25) ? TFT_GREEN : TFT_BLUE) : TFT_RED);
+  this->formatTemperature(this->tmpStr1, this->params.batModuleTempC[0], "", " ");
+  drawSmallCell(0, 1, 1, 1, this->tmpStr1, "MO1", TFT_TEMP, (this->params.batModuleTempC[0] >= 15) ? ((this->params.batModuleTempC[0] >= 25) ? TFT_GREEN : TFT_BLUE) : TFT_RED);
+  this->formatTemperature(this->tmpStr1, this->params.batModuleTempC[1], "", " ");
+  drawSmallCell(1, 1, 1, 1, this->tmpStr1, "MO2", TFT_TEMP, (this->params.batModuleTempC[1] >= 15) ? ((this->params.batModuleTempC[1] >= 25) ? TFT_GREEN : TFT_BLUE) : TFT_RED);
+  this->formatTemperature(this->tmpStr1, this->params.batModuleTempC[2], "", " ");
+  drawSmallCell(2, 1, 1, 1, this->tmpStr1, "MO3", TFT_TEMP, (this->params.batModuleTempC[2] >= 15) ? ((this->params.batModuleTempC[2] >= 25) ? TFT_GREEN : TFT_BLUE) : TFT_RED);
+  this->formatTemperature(this->tmpStr1, this->params.batModuleTempC[3], "", " ");
+  drawSmallCell(3, 1, 1, 1, this->tmpStr1, "MO4", TFT_TEMP, (this->params.batModuleTempC[3] >= 15) ? ((this->params.batModuleTempC[3] >= 25) ? TFT_GREEN : TFT_BLUE) : TFT_RED);
   // Ioniq (up to 12 cells)
-  for (uint16_t i = 4; i < this->liveData->params.batModuleTempCount; i++) {
-    if (this->liveData->params.batModuleTempC[i] == 0)
+  for (uint16_t i = 4; i < this->params.batModuleTempCount; i++) {
+    if (this->params.batModuleTempC[i] == 0)
       continue;
     posx = (((i - 4) % 8) * 40);
     posy = ((floor((i - 4) / 8)) * 13) + 64;
     //this->spr.fillRect(x * 80, y * 32, ((w) * 80), ((h) * 32),  bgColor);
     this->spr.setTextSize(1); // Size for small 5x7 font
     this->spr.setTextDatum(TL_DATUM);
-    this->spr.setTextColor(((this->liveData->params.batModuleTempC[i] >= 15) ? ((this->liveData->params.batModuleTempC[i] >= 25) ? TFT_GREEN : TFT_BLUE) : TFT_RED), TFT_BLACK);
-    sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "%01.00fC" : "%01.01fF"), this->liveData->celsius2temperature(this->liveData->params.batModuleTempC[i]));
+    this->spr.setTextColor(((this->params.batModuleTempC[i] >= 15) ? ((this->params.batModuleTempC[i] >= 25) ? TFT_GREEN : TFT_BLUE) : TFT_RED), TFT_BLACK);
+    this->formatTemperature(this->tmpStr1, this->params.batModuleTempC[i], "", "");
     this->spr.drawString(this->tmpStr1, posx + 4, posy, 2);
   }
 
   this->spr.setTextDatum(TL_DATUM); // Topleft
   this->spr.setTextSize(1); // Size for small 5x7 font
 
-  // Find min and max val
-  float minVal = -1, maxVal = -1;
-  for (int i = 0; i < 98; i++) {
-    if ((this->liveData->params.cellVoltage[i] < minVal || minVal == -1) && this->liveData->params.cellVoltage[i] != -1)
-      minVal = this->liveData->params.cellVoltage[i];
-    if ((this->liveData->params.cellVoltage[i] > maxVal || maxVal == -1) && this->liveData->params.cellVoltage[i] != -1)
-      maxVal = this->liveData->params.cellVoltage[i];
-    if (this->liveData->params.cellVoltage[i] > 0 && i > this->liveData->params.cellCount + 1)
-      this->liveData->params.cellCount = i + 1;
-  }
+  // Min and max val (computed by parser)
+  float minVal = this->params.cellStatsMinV, maxVal = this->params.cellStatsMaxV;
 
   // Draw cell matrix
   for (int i = 0; i < 98; i++) {
-    if (this->liveData->params.cellVoltage[i] == -1)
+    if (this->params.cellVoltage[i] == -1)
       continue;
     posx = ((i % 8) * 40) + 4;
-    posy = ((floor(i / 8) + (this->liveData->params.cellCount > 96 ? 0 : 1)) * 13) + 68;
-    sprintf(this->tmpStr3, "%01.02f", this->liveData->params.cellVoltage[i]);
+    posy = ((floor(i / 8) + (this->params.cellCount > 96 ? 0 : 1)) * 13) + 68;
+    this->formatNumber(this->tmpStr3, this->params.cellVoltage[i], 2);
     this->spr.setTextColor(TFT_NAVY, TFT_BLACK);
-    if (this->liveData->params.cellVoltage[i] == minVal && minVal != maxVal)
+    if (this->params.cellVoltage[i] == minVal && minVal != maxVal)
       this->spr.setTextColor(TFT_RED, TFT_BLACK);
-    if (this->liveData->params.cellVoltage[i] == maxVal && minVal != maxVal)
+    if (this->params.cellVoltage[i] == maxVal && minVal != maxVal)
       this->spr.setTextColor(TFT_GREEN, TFT_BLACK);
     this->spr.drawString(this->tmpStr3, posx, posy, 2);
   }
@@ -460,80 +756,49 @@ void Board320_240::drawSceneBatteryCells() {
 */
 void Board320_240::drawPreDrawnChargingGraphs(int zeroX, int zeroY, int mulX, int mulY) {
 
-  // Rapid gate
-  this->spr.drawLine(zeroX + (/* SOC FROM */ 1 * mulX), zeroY - (/*I*/ 180 * /*U SOC*/ (1 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX +  (/* SOC TO */ 57 * mulX), zeroY - (/*I*/ 180 * /*U SOC*/ (57 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_RAPIDGATE35);
-  // Coldgate <5C
-  this->spr.drawLine(zeroX + (/* SOC FROM */ 1 * mulX), zeroY - (/*I*/ 60 * /*U SOC*/ (1 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX +  (/* SOC TO */ 65 * mulX), zeroY - (/*I*/ 60 * /*U SOC*/ (65 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_COLDGATE0_5);
-  // Coldgate 5-14C
-  this->spr.drawLine(zeroX + (/* SOC FROM */ 1 * mulX), zeroY - (/*I*/ 110 * /*U SOC*/ (1 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX +  (/* SOC TO */ 57 * mulX), zeroY - (/*I*/ 110 * /*U SOC*/ (57 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_COLDGATE5_14);
-  this->spr.drawLine(zeroX +  (/* SOC FROM */ 57 * mulX), zeroY - (/*I*/ 110 * /*U SOC*/ (57 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX + (/* SOC TO */ 58 * mulX), zeroY - (/*I*/ 75 * /*U SOC*/ (58 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_COLDGATE5_14);
-  this->spr.drawLine(zeroX + (/* SOC FROM */ 58 * mulX), zeroY - (/*I*/ 75 * /*U SOC*/ (58 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX +  (/* SOC TO */ 64 * mulX), zeroY - (/*I*/ 75 * /*U SOC*/ (64 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_COLDGATE5_14);
-  this->spr.drawLine(zeroX + (/* SOC FROM */ 64 * mulX), zeroY - (/*I*/ 75 * /*U SOC*/ (64 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX +  (/* SOC TO */ 65 * mulX), zeroY - (/*I*/ 60 * /*U SOC*/ (65 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_COLDGATE5_14);
-  this->spr.drawLine(zeroX + (/* SOC FROM */ 65 * mulX), zeroY - (/*I*/ 60 * /*U SOC*/ (65 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX +  (/* SOC TO */ 82 * mulX), zeroY - (/*I*/ 60 * /*U SOC*/ (82 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_COLDGATE5_14);
-  this->spr.drawLine(zeroX + (/* SOC FROM */ 82 * mulX), zeroY - (/*I*/ 60 * /*U SOC*/ (82 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX +  (/* SOC TO */ 83 * mulX), zeroY - (/*I*/ 40 * /*U SOC*/ (83 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_COLDGATE5_14);
-  // Coldgate 15-24C
-  this->spr.drawLine(zeroX + (/* SOC FROM */ 1 * mulX), zeroY - (/*I*/ 150 * /*U SOC*/ (1 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX +  (/* SOC TO */ 57 * mulX), zeroY - (/*I*/ 150 * /*U SOC*/ (57 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_COLDGATE15_24);
-  this->spr.drawLine(zeroX +  (/* SOC FROM */ 57 * mulX), zeroY - (/*I*/ 150 * /*U SOC*/ (57 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX + (/* SOC FROM */ 58 * mulX), zeroY - (/*I*/ 110 * /*U SOC*/ (58 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_COLDGATE15_24);
-  this->spr.drawLine(zeroX + (/* SOC TO */ 58 * mulX), zeroY - (/*I*/ 110 * /*U SOC*/ (58 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX +  (/* SOC TO */ 78 * mulX), zeroY - (/*I*/ 110 * /*U SOC*/ (78 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_COLDGATE15_24);
-  // Optimal
-  this->spr.drawLine(zeroX + (/* SOC FROM */ 1 * mulX), zeroY - (/*I*/ 200 * /*U SOC*/ (1 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX +  (/* SOC TO */ 57 * mulX), zeroY - (/*I*/ 200 * /*U SOC*/ (57 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_OPTIMAL25);
-  this->spr.drawLine(zeroX +  (/* SOC FROM */ 51 * mulX), zeroY - (/*I*/ 200 * /*U SOC*/ (51 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX + (/* SOC TO */ 51 * mulX), zeroY - (/*I*/ 195 * /*U SOC*/ (51 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_OPTIMAL25);
-  this->spr.drawLine(zeroX +  (/* SOC FROM */ 53 * mulX), zeroY - (/*I*/ 200 * /*U SOC*/ (53 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX + (/* SOC TO */ 53 * mulX), zeroY - (/*I*/ 195 * /*U SOC*/ (53 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_OPTIMAL25);
-  this->spr.drawLine(zeroX +  (/* SOC FROM */ 55 * mulX), zeroY - (/*I*/ 200 * /*U SOC*/ (55 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX + (/* SOC TO */ 55 * mulX), zeroY - (/*I*/ 195 * /*U SOC*/ (55 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_OPTIMAL25);
-  this->spr.drawLine(zeroX +  (/* SOC FROM */ 57 * mulX), zeroY - (/*I*/ 200 * /*U SOC*/ (57 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX + (/* SOC TO */ 58 * mulX), zeroY - (/*I*/ 150 * /*U SOC*/ (58 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_OPTIMAL25);
-  this->spr.drawLine(zeroX + (/* SOC FROM */ 58 * mulX), zeroY - (/*I*/ 150 * /*U SOC*/ (58 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX +  (/* SOC TO */ 77 * mulX), zeroY - (/*I*/ 150 * /*U SOC*/ (77 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_OPTIMAL25);
-  this->spr.drawLine(zeroX +  (/* SOC FROM */ 71 * mulX), zeroY - (/*I*/ 150 * /*U SOC*/ (71 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX + (/* SOC TO */ 71 * mulX), zeroY - (/*I*/ 145 * /*U SOC*/ (71 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_OPTIMAL25);
-  this->spr.drawLine(zeroX +  (/* SOC FROM */ 73 * mulX), zeroY - (/*I*/ 150 * /*U SOC*/ (73 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX + (/* SOC TO */ 73 * mulX), zeroY - (/*I*/ 145 * /*U SOC*/ (73 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_OPTIMAL25);
-  this->spr.drawLine(zeroX +  (/* SOC FROM */ 75 * mulX), zeroY - (/*I*/ 150 * /*U SOC*/ (75 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX + (/* SOC TO */ 75 * mulX), zeroY - (/*I*/ 145 * /*U SOC*/ (75 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_OPTIMAL25);
-  this->spr.drawLine(zeroX +  (/* SOC FROM */ 77 * mulX), zeroY - (/*I*/ 150 * /*U SOC*/ (77 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX + (/* SOC TO */ 78 * mulX), zeroY - (/*I*/ 90 * /*U SOC*/ (78 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_OPTIMAL25);
-  this->spr.drawLine(zeroX + (/* SOC FROM */ 78 * mulX), zeroY - (/*I*/ 90 * /*U SOC*/ (78 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX +  (/* SOC TO */ 82 * mulX), zeroY - (/*I*/ 90 * /*U SOC*/ (82 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_OPTIMAL25);
-  this->spr.drawLine(zeroX +  (/* SOC FROM */ 82 * mulX), zeroY - (/*I*/ 90 * /*U SOC*/ (82 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX + (/* SOC TO */ 83 * mulX), zeroY - (/*I*/ 60 * /*U SOC*/ (83 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_OPTIMAL25);
-  this->spr.drawLine(zeroX + (/* SOC FROM */ 83 * mulX), zeroY - (/*I*/ 60 * /*U SOC*/ (83 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX +  (/* SOC TO */ 92 * mulX), zeroY - (/*I*/ 60 * /*U SOC*/ (92 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_OPTIMAL25);
-  this->spr.drawLine(zeroX +  (/* SOC FROM */ 92 * mulX), zeroY - (/*I*/ 60 * /*U SOC*/ (92 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX +  (/* SOC TO */ 95 * mulX), zeroY - (/*I*/ 35 * /*U SOC*/ (95 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_OPTIMAL25);
-  this->spr.drawLine(zeroX +  (/* SOC FROM */ 95 * mulX), zeroY - (/*I*/ 35 * /*U SOC*/ (95 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX +  (/* SOC TO */ 98 * mulX), zeroY - (/*I*/ 35 * /*U SOC*/ (98 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_OPTIMAL25);
-  this->spr.drawLine(zeroX +  (/* SOC FROM */ 98 * mulX), zeroY - (/*I*/ 35 * /*U SOC*/ (98 * 55 / 100 + 352) /**/ / 1000 * mulY),
-                     zeroX +  (/* SOC TO */ 100 * mulX), zeroY - (/*I*/ 15 * /*U SOC*/ (100 * 55 / 100 + 352) /**/ / 1000 * mulY), TFT_GRAPH_OPTIMAL25);
-  // Triangles
-  int x = zeroX;
-  int y;
-  if (this->liveData->params.batMaxC >= 35) {
-    y = zeroY - (/*I*/ 180 * /*U SOC*/ (1 * 55 / 100 + 352) /**/ / 1000 * mulY);
-  } else if (this->liveData->params.batMinC >= 25) {
-    y = zeroY - (/*I*/ 200 * /*U SOC*/ (1 * 55 / 100 + 352) /**/ / 1000 * mulY);
-  } else if (this->liveData->params.batMinC >= 15) {
-    y = zeroY - (/*I*/ 150 * /*U SOC*/ (1 * 55 / 100 + 352) /**/ / 1000 * mulY);
-  } else if (this->liveData->params.batMinC >= 5) {
-    y = zeroY - (/*I*/ 110 * /*U SOC*/ (1 * 55 / 100 + 352) /**/ / 1000 * mulY);
+  const CHARGING_CURVE_LINE* curves = this->carInterface->chargingCurves;
+  uint8_t curvesCount = (this->carInterface->chargingCurvesCount > CHARGING_CURVES_MAX) ? CHARGING_CURVES_MAX : this->carInterface->chargingCurvesCount;
+
+  // Pixel endpoints are computed once per car and graph scale
+  if (this->chargingCurvesCached != curves || this->chargingCurvesZeroX != zeroX || this->chargingCurvesZeroY != zeroY || this->chargingCurvesMulX != mulX || this->chargingCurvesMulY != mulY) {
+    for (uint8_t i = 0; i < curvesCount; i++) {
+      this->chargingCurvesPx[i][0] = zeroX + (curves[i].socFrom * mulX);
+      this->chargingCurvesPx[i][1] = zeroY - (this->carInterface->chargingCurveKw(curves[i].socFrom, curves[i].ampsFrom) * mulY);
+      this->chargingCurvesPx[i][2] = zeroX + (curves[i].socTo * mulX);
+      this->chargingCurvesPx[i][3] = zeroY - (this->carInterface->chargingCurveKw(curves[i].socTo, curves[i].ampsTo) * mulY);
+    }
+    this->chargingCurvesCached = curves;
+    this->chargingCurvesZeroX = zeroX;
+    this->chargingCurvesZeroY = zeroY;
+    this->chargingCurvesMulX = mulX;
+    this->chargingCurvesMulY = mulY;
+  }
+
+  for (uint8_t i = 0; i < curvesCount; i++) {
+    this->spr.drawLine(this->chargingCurvesPx[i][0], this->chargingCurvesPx[i][1], this->chargingCurvesPx[i][2], this->chargingCurvesPx[i][3], curves[i].color);
+  }
+
+  // Triangle at start of curve allowed by battery temperature
+  uint16_t gateColor;
+  if (this->params.batMaxC >= 35) {
+    gateColor = TFT_GRAPH_RAPIDGATE35;
+  } else if (this->params.batMinC >= 25) {
+    gateColor = TFT_GRAPH_OPTIMAL25;
+  } else if (this->params.batMinC >= 15) {
+    gateColor = TFT_GRAPH_COLDGATE15_24;
+  } else if (this->params.batMinC >= 5) {
+    gateColor = TFT_GRAPH_COLDGATE5_14;
   } else {
-    y = zeroY - (/*I*/ 60 * /*U SOC*/ (1 * 55 / 100 + 352) /**/ / 1000 * mulY);
+    gateColor = TFT_GRAPH_COLDGATE0_5;
+  }
+  for (uint8_t i = 0; i < curvesCount; i++) {
+    if (curves[i].color == gateColor) {
+      int x = zeroX;
+      int y = this->chargingCurvesPx[i][1];
+      this->spr.fillTriangle(x + 5, y,  x , y - 5, x, y + 5, TFT_ORANGE);
+      break;
+    }
   }
-  this->spr.fillTriangle(x + 5, y,  x , y - 5, x, y + 5, TFT_ORANGE);
 }
 
 /**
@@ -551,22 +816,22 @@ void Board320_240::drawSceneChargingGraph() {
 
   this->spr.fillSprite(TFT_BLACK);
 
-  sprintf(this->tmpStr1, "%01.00f", this->liveData->params.socPerc);
+  this->formatNumber(this->tmpStr1, this->params.socPerc, 0);
   drawSmallCell(0, 0, 1, 1, this->tmpStr1, "SOC", TFT_TEMP, TFT_CYAN);
-  sprintf(this->tmpStr1, "%01.01f", this->liveData->params.batPowerKw);
+  this->formatNumber(this->tmpStr1, this->params.batPowerKw, 1);
   drawSmallCell(1, 0, 1, 1, this->tmpStr1, "POWER kW", TFT_TEMP, TFT_CYAN);
-  sprintf(this->tmpStr1, "%01.01f", this->liveData->params.batPowerAmp);
+  this->formatNumber(this->tmpStr1, this->params.batPowerAmp, 1);
   drawSmallCell(2, 0, 1, 1, this->tmpStr1, "CURRENT A", TFT_TEMP, TFT_CYAN);
-  sprintf(this->tmpStr1, "%03.00f", this->liveData->params.batVoltage);
+  this->formatNumber(this->tmpStr1, this->params.batVoltage, 0, "", "", 3);
   drawSmallCell(3, 0, 1, 1, this->tmpStr1, "VOLTAGE", TFT_TEMP, TFT_CYAN);
 
-  sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "%01.00f C" : "%01.01f F"), this->liveData->celsius2temperature(this->liveData->params.batHeaterC));
+  this->formatTemperature(this->tmpStr1, this->params.batHeaterC, "", " ");
   drawSmallCell(0, 1, 1, 1, this->tmpStr1, "HEATER", TFT_TEMP, TFT_RED);
-  sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "%01.00f C" : "%01.01f F"), this->liveData->celsius2temperature(this->liveData->params.batInletC));
+  this->formatTemperature(this->tmpStr1, this->params.batInletC, "", " ");
   drawSmallCell(1, 1, 1, 1, this->tmpStr1, "BAT.INLET", TFT_TEMP, TFT_CYAN);
-  sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "%01.00f C" : "%01.01f F"), this->liveData->celsius2temperature(this->liveData->params.batMinC));
-  drawSmallCell(2, 1, 1, 1, this->tmpStr1, "BAT.MIN", (this->liveData->params.batMinC >= 15) ? ((this->liveData->params.batMinC >= 25) ? TFT_DARKGREEN2 : TFT_BLUE) : TFT_RED, TFT_CYAN);
-  sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "%01.00f C" : "%01.01f F"), this->liveData->celsius2temperature(this->liveData->params.outdoorTemperature));
+  this->formatTemperature(this->tmpStr1, this->params.batMinC, "", " ");
+  drawSmallCell(2, 1, 1, 1, this->tmpStr1, "BAT.MIN", (this->params.batMinC >= 15) ? ((this->params.batMinC >= 25) ? TFT_DARKGREEN2 : TFT_BLUE) : TFT_RED, TFT_CYAN);
+  this->formatTemperature(this->tmpStr1, this->params.outdoorTemperature, "", " ");
   drawSmallCell(3, 1, 1, 1, this->tmpStr1, "OUT.TEMP.", TFT_TEMP, TFT_CYAN);
 
   this->spr.setTextColor(TFT_SILVER, TFT_TEMP);
@@ -598,100 +863,100 @@ void Board320_240::drawSceneChargingGraph() {
 
   // Draw realtime values
   for (int i = 0; i <= 100; i++) {
-    if (this->liveData->params.chargingGraphBatMinTempC[i] > -10)
-      this->spr.drawFastHLine(zeroX + (i * mulX) - (mulX / 2), zeroY - (this->liveData->params.chargingGraphBatMinTempC[i]*mulY), mulX, TFT_BLUE);
-    if (this->liveData->params.chargingGraphBatMaxTempC[i] > -10)
-      this->spr.drawFastHLine(zeroX + (i * mulX) - (mulX / 2), zeroY - (this->liveData->params.chargingGraphBatMaxTempC[i]*mulY), mulX, TFT_BLUE);
-    if (this->liveData->params.chargingGraphWaterCoolantTempC[i] > -10)
-      this->spr.drawFastHLine(zeroX + (i * mulX) - (mulX / 2), zeroY - (this->liveData->params.chargingGraphWaterCoolantTempC[i]*mulY), mulX, TFT_PURPLE);
-    if (this->liveData->params.chargingGraphHeaterTempC[i] > -10)
-      this->spr.drawFastHLine(zeroX + (i * mulX) - (mulX / 2), zeroY - (this->liveData->params.chargingGraphHeaterTempC[i]*mulY), mulX, TFT_RED);
-
-    if (this->liveData->params.chargingGraphMinKw[i] > 0)
-      this->spr.drawFastHLine(zeroX + (i * mulX) - (mulX / 2), zeroY - (this->liveData->params.chargingGraphMinKw[i]*mulY), mulX, TFT_GREENYELLOW);
-    if (this->liveData->params.chargingGraphMaxKw[i] > 0)
-      this->spr.drawFastHLine(zeroX + (i * mulX) - (mulX / 2), zeroY - (this->liveData->params.chargingGraphMaxKw[i]*mulY), mulX, TFT_YELLOW);
+    if (this->params.chargingGraphBatMinTempC[i] > -10)
+      this->spr.drawFastHLine(zeroX + (i * mulX) - (mulX / 2), zeroY - (this->params.chargingGraphBatMinTempC[i]*mulY), mulX, TFT_BLUE);
+    if (this->params.chargingGraphBatMaxTempC[i] > -10)
+      this->spr.drawFastHLine(zeroX + (i * mulX) - (mulX / 2), zeroY - (this->params.chargingGraphBatMaxTempC[i]*mulY), mulX, TFT_BLUE);
+    if (this->params.chargingGraphWaterCoolantTempC[i] > -10)
+      this->spr.drawFastHLine(zeroX + (i * mulX) - (mulX / 2), zeroY - (this->params.chargingGraphWaterCoolantTempC[i]*mulY), mulX, TFT_PURPLE);
+    if (this->params.chargingGraphHeaterTempC[i] > -10)
+      this->spr.drawFastHLine(zeroX + (i * mulX) - (mulX / 2), zeroY - (this->params.chargingGraphHeaterTempC[i]*mulY), mulX, TFT_RED);
+
+    if (this->params.chargingGraphMinKw[i] > 0)
+      this->spr.drawFastHLine(zeroX + (i * mulX) - (mulX / 2), zeroY - (this->params.chargingGraphMinKw[i]*mulY), mulX, TFT_GREENYELLOW);
+    if (this->params.chargingGraphMaxKw[i] > 0)
+      this->spr.drawFastHLine(zeroX + (i * mulX) - (mulX / 2), zeroY - (this->params.chargingGraphMaxKw[i]*mulY), mulX, TFT_YELLOW);
   }
 
   // Bat.module temperatures
   this->spr.setTextSize(1); // Size for small 5x7 font
   this->spr.setTextDatum(BL_DATUM);
-  sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "1=%01.00fC " : "1=%01.00fF "), this->liveData->celsius2temperature(this->liveData->params.batModuleTempC[0]));
-  this->spr.setTextColor((this->liveData->params.batModuleTempC[0] >= 15) ? ((this->liveData->params.batModuleTempC[0] >= 25) ? TFT_GREEN : TFT_BLUE) : TFT_RED, TFT_TEMP);
+  this->formatNumber(this->tmpStr1, this->liveData->celsius2temperature(this->params.batModuleTempC[0]), 0, "1=", ((this->liveData->settings.temperatureUnit == 'c') ? "C " : "F "));
+  this->spr.setTextColor((this->params.batModuleTempC[0] >= 15) ? ((this->params.batModuleTempC[0] >= 25) ? TFT_GREEN : TFT_BLUE) : TFT_RED, TFT_TEMP);
   this->spr.drawString(this->tmpStr1, 0,  zeroY - (maxKw * mulY), 2);
 
-  sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "2=%01.00fC " : "2=%01.00fF "), this->liveData->celsius2temperature(this->liveData->params.batModuleTempC[1]));
-  this->spr.setTextColor((this->liveData->params.batModuleTempC[1] >= 15) ? ((this->liveData->params.batModuleTempC[1] >= 25) ? TFT_GREEN : TFT_BLUE) : TFT_RED, TFT_TEMP);
+  this->formatNumber(this->tmpStr1, this->liveData->celsius2temperature(this->params.batModuleTempC[1]), 0, "2=", ((this->liveData->settings.temperatureUnit == 'c') ? "C " : "F "));
+  this->spr.setTextColor((this->params.batModuleTempC[1] >= 15) ? ((this->params.batModuleTempC[1] >= 25) ? TFT_GREEN : TFT_BLUE) : TFT_RED, TFT_TEMP);
   this->spr.drawString(this->tmpStr1, 48,  zeroY - (maxKw * mulY), 2);
 
-  sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "3=%01.00fC " : "3=%01.00fF "), this->liveData->celsius2temperature(this->liveData->params.batModuleTempC[2]));
-  this->spr.setTextColor((this->liveData->params.batModuleTempC[2] >= 15) ? ((this->liveData->params.batModuleTempC[2] >= 25) ? TFT_GREEN : TFT_BLUE) : TFT_RED, TFT_TEMP);
+  this->formatNumber(this->tmpStr1, this->liveData->celsius2temperature(this->params.batModuleTempC[2]), 0, "3=", ((this->liveData->settings.temperatureUnit == 'c') ? "C " : "F "));
+  this->spr.setTextColor((this->params.batModuleTempC[2] >= 15) ? ((this->params.batModuleTempC[2] >= 25) ? TFT_GREEN : TFT_BLUE) : TFT_RED, TFT_TEMP);
   this->spr.drawString(this->tmpStr1, 96,  zeroY - (maxKw * mulY), 2);
 
-  sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "4=%01.00fC " : "4=%01.00fF "), this->liveData->celsius2temperature(this->liveData->params.batModuleTempC[3]));
-  this->spr.setTextColor((this->liveData->params.batModuleTempC[3] >= 15) ? ((this->liveData->params.batModuleTempC[3] >= 25) ? TFT_GREEN : TFT_BLUE) : TFT_RED, TFT_TEMP);
+  this->formatNumber(this->tmpStr1, this->liveData->celsius2temperature(this->params.batModuleTempC[3]), 0, "4=", ((this->liveData->settings.temperatureUnit == 'c') ? "C " : "F "));
+  this->spr.setTextColor((this->params.batModuleTempC[3] >= 15) ? ((this->params.batModuleTempC[3] >= 25) ? TFT_GREEN : TFT_BLUE) : TFT_RED, TFT_TEMP);
   this->spr.drawString(this->tmpStr1, 144,  zeroY - (maxKw * mulY), 2);
-  sprintf(this->tmpStr1, "ir %01.00fkOhm", this->liveData->params.isolationResistanceKOhm );
+  this->formatNumber(this->tmpStr1, this->params.isolationResistanceKOhm, 0, "ir ", "kOhm");
 
   // Bms max.regen/power available
   this->spr.setTextColor(TFT_WHITE, TFT_BLACK);
-  sprintf(this->tmpStr1, "xC=%01.00fkW ", this->liveData->params.availableChargePower);
+  this->formatNumber(this->tmpStr1, this->params.availableChargePower, 0, "xC=", "kW ");
   this->spr.drawString(this->tmpStr1, 192,  zeroY - (maxKw * mulY), 2);
   this->spr.setTextColor(TFT_WHITE, TFT_BLACK);
-  sprintf(this->tmpStr1, "xD=%01.00fkW", this->liveData->params.availableDischargePower);
+  this->formatNumber(this->tmpStr1, this->params.availableDischargePower, 0, "xD=", "kW");
   this->spr.drawString(this->tmpStr1, 256,  zeroY - (maxKw * mulY), 2);
 
   //
   this->spr.setTextDatum(TR_DATUM);
-  if (this->liveData->params.coolingWaterTempC != -1) {
-    sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "W=%01.00fC" : "W=%01.00fF"), this->liveData->celsius2temperature(this->liveData->params.coolingWaterTempC));
+  if (this->params.coolingWaterTempC != -1) {
+    this->formatNumber(this->tmpStr1, this->liveData->celsius2temperature(this->params.coolingWaterTempC), 0, "W=", ((this->liveData->settings.temperatureUnit == 'c') ? "C" : "F"));
     this->spr.setTextColor(TFT_PURPLE, TFT_TEMP);
     this->spr.drawString(this->tmpStr1, zeroX + (10 * 10 * mulX),  zeroY - (maxKw * mulY) + (posy * 15), 2);
     posy++;
   }
   this->spr.setTextColor(TFT_WHITE, TFT_TEMP);
-  if (this->liveData->params.batFanFeedbackHz > 0) {
-    sprintf(this->tmpStr1, "FF=%03.00fHz", this->liveData->params.batFanFeedbackHz);
+  if (this->params.batFanFeedbackHz > 0) {
+    this->formatNumber(this->tmpStr1, this->params.batFanFeedbackHz, 0, "FF=", "Hz", 3);
     this->spr.drawString(this->tmpStr1, zeroX + (10 * 10 * mulX),  zeroY - (maxKw * mulY) + (posy * 15), 2);
     posy++;
   }
-  if (this->liveData->params.batFanStatus > 0) {
-    sprintf(this->tmpStr1, "FS=%03.00f", this->liveData->params.batFanStatus);
+  if (this->params.batFanStatus > 0) {
+    this->formatNumber(this->tmpStr1, this->params.batFanStatus, 0, "FS=", "", 3);
     this->spr.drawString(this->tmpStr1, zeroX + (10 * 10 * mulX),  zeroY - (maxKw * mulY) + (posy * 15), 2);
     posy++;
   }
-  if (this->liveData->params.coolantTemp1C != -1 && this->liveData->params.coolantTemp2C != -1) {
-    sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "C1/2:%01.00f/%01.00fC" : "C1/2:%01.00f/%01.00fF"), this->liveData->celsius2temperature(this->liveData->params.coolantTemp1C), this->liveData->celsius2temperature(this->liveData->params.coolantTemp2C));
+  if (this->params.coolantTemp1C != -1 && this->params.coolantTemp2C != -1) {
+    this->formatNumber(this->formatNumber(this->tmpStr1, this->liveData->celsius2temperature(this->params.coolantTemp1C), 0, "C1/2:", "/"), this->liveData->celsius2temperature(this->params.coolantTemp2C), 0, "", ((this->liveData->settings.temperatureUnit == 'c') ? "C" : "F"));
     this->spr.drawString(this->tmpStr1, zeroX + (10 * 10 * mulX),  zeroY - (maxKw * mulY) + (posy * 15), 2);
     posy++;
   }
-  if (this->liveData->params.bmsUnknownTempA != -1) {
-    sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "A=%01.00fC" : "W=%01.00fF"), this->liveData->celsius2temperature(this->liveData->params.bmsUnknownTempA));
+  if (this->params.bmsUnknownTempA != -1) {
+    this->formatNumber(this->tmpStr1, this->liveData->celsius2temperature(this->params.bmsUnknownTempA), 0, "A=", ((this->liveData->settings.temperatureUnit == 'c') ? "C" : "F"));
     this->spr.drawString(this->tmpStr1, zeroX + (10 * 10 * mulX),  zeroY - (maxKw * mulY) + (posy * 15), 2);
     posy++;
   }
-  if (this->liveData->params.bmsUnknownTempB != -1) {
-    sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "B=%01.00fC" : "W=%01.00fF"), this->liveData->celsius2temperature(this->liveData->params.bmsUnknownTempB));
+  if (this->params.bmsUnknownTempB != -1) {
+    this->formatNumber(this->tmpStr1, this->liveData->celsius2temperature(this->params.bmsUnknownTempB), 0, "B=", ((this->liveData->settings.temperatureUnit == 'c') ? "C" : "F"));
     this->spr.drawString(this->tmpStr1, zeroX + (10 * 10 * mulX),  zeroY - (maxKw * mulY) + (posy * 15), 2);
     posy++;
   }
-  if (this->liveData->params.bmsUnknownTempC != -1) {
-    sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "C=%01.00fC" : "W=%01.00fF"), this->liveData->celsius2temperature(this->liveData->params.bmsUnknownTempC));
+  if (this->params.bmsUnknownTempC != -1) {
+    this->formatNumber(this->tmpStr1, this->liveData->celsius2temperature(this->params.bmsUnknownTempC), 0, "C=", ((this->liveData->settings.temperatureUnit == 'c') ? "C" : "F"));
     this->spr.drawString(this->tmpStr1, zeroX + (10 * 10 * mulX),  zeroY - (maxKw * mulY) + (posy * 15), 2);
     posy++;
   }
-  if (this->liveData->params.bmsUnknownTempD != -1) {
-    sprintf(this->tmpStr1, ((this->liveData->settings.temperatureUnit == 'c') ? "D=%01.00fC" : "W=%01.00fF"), this->liveData->celsius2temperature(this->liveData->params.bmsUnknownTempD));
+  if (this->params.bmsUnknownTempD != -1) {
+    this->formatNumber(this->tmpStr1, this->liveData->celsius2temperature(this->params.bmsUnknownTempD), 0, "D=", ((this->liveData->settings.temperatureUnit == 'c') ? "C" : "F"));
     this->spr.drawString(this->tmpStr1, zeroX + (10 * 10 * mulX),  zeroY - (maxKw * mulY) + (posy * 15), 2);
     posy++;
   }
 
   // Print charging time
-  time_t diffTime = this->liveData->params.currentTime - this->liveData->params.chargingStartTime;
+  time_t diffTime = this->params.currentTime - this->params.chargingStartTime;
   if ((diffTime / 60) > 99)
-    sprintf(this->tmpStr1, "%02d:%02d:%02d", (diffTime / 3600) % 24, (diffTime / 60) % 60, diffTime % 60);
+    sprintf(this->tmpStr1, "%02d:%02d:%02d", (int)((diffTime / 3600) % 24), (int)((diffTime / 60) % 60), (int)(diffTime % 60));
   else
-    sprintf(this->tmpStr1, "%02d:%02d", (diffTime / 60), diffTime % 60);
+    sprintf(this->tmpStr1, "%02d:%02d", (int)(diffTime / 60), (int)(diffTime % 60));
   this->spr.setTextDatum(TL_DATUM);
   this->spr.setTextColor(TFT_SILVER, TFT_BLACK);
   this->spr.drawString(this->tmpStr1, 0, zeroY - (maxKw * mulY), 2);
@@ -725,45 +990,45 @@ void Board320_240::drawSceneSoc10Table() {
     sprintf(this->tmpStr1, "%d%%", (i == 0) ? 5 : i * 10);
     this->spr.drawString(this->tmpStr1, 32, zeroY + ((12 - i) * 15), 2);
 
-    firstCed = (this->liveData->params.soc10ced[i] != -1) ? this->liveData->params.soc10ced[i] : firstCed;
-    lastCed = (lastCed == -1 && this->liveData->params.soc10ced[i] != -1) ? this->liveData->params.soc10ced[i] : lastCed;
-    firstCec = (this->liveData->params.soc10cec[i] != -1) ? this->liveData->params.soc10cec[i] : firstCec;
-    lastCec = (lastCec == -1 && this->liveData->params.soc10cec[i] != -1) ? this->liveData->params.soc10cec[i] : lastCec;
-    firstOdo = (this->liveData->params.soc10odo[i] != -1) ? this->liveData->params.soc10odo[i] : firstOdo;
-    lastOdo = (lastOdo == -1 && this->liveData->params.soc10odo[i] != -1) ? this->liveData->params.soc10odo[i] : lastOdo;
+    firstCed = (this->params.soc10ced[i] != -1) ? this->params.soc10ced[i] : firstCed;
+    lastCed = (lastCed == -1 && this->params.soc10ced[i] != -1) ? this->params.soc10ced[i] : lastCed;
+    firstCec = (this->params.soc10cec[i] != -1) ? this->params.soc10cec[i] : firstCec;
+    lastCec = (lastCec == -1 && this->params.soc10cec[i] != -1) ? this->params.soc10cec[i] : lastCec;
+    firstOdo = (this->params.soc10odo[i] != -1) ? this->params.soc10odo[i] : firstOdo;
+    lastOdo = (lastOdo == -1 && this->params.soc10odo[i] != -1) ? this->params.soc10odo[i] : lastOdo;
 
     if (i != 10) {
-      diffCec = (this->liveData->params.soc10cec[i + 1] != -1 && this->liveData->params.soc10cec[i] != -1) ? (this->liveData->params.soc10cec[i] - this->liveData->params.soc10cec[i + 1]) : 0;
-      diffCed = (this->liveData->params.soc10ced[i + 1] != -1 && this->liveData->params.soc10ced[i] != -1) ? (this->liveData->params.soc10ced[i + 1] - this->liveData->params.soc10ced[i]) : 0;
-      diffOdo = (this->liveData->params.soc10odo[i + 1] != -1 && this->liveData->params.soc10odo[i] != -1) ? (this->liveData->params.soc10odo[i] - this->liveData->params.soc10odo[i + 1]) : -1;
-      diffTime = (this->liveData->params.soc10time[i + 1] != -1 && this->liveData->params.soc10time[i] != -1) ? (this->liveData->params.soc10time[i] - this->liveData->params.soc10time[i + 1]) : -1;
+      diffCec = (this->params.soc10cec[i + 1] != -1 && this->params.soc10cec[i] != -1) ? (this->params.soc10cec[i] - this->params.soc10cec[i + 1]) : 0;
+      diffCed = (this->params.soc10ced[i + 1] != -1 && this->params.soc10ced[i] != -1) ? (this->params.soc10ced[i + 1] - this->params.soc10ced[i]) : 0;
+      diffOdo = (this->params.soc10odo[i + 1] != -1 && this->params.soc10odo[i] != -1) ? (this->params.soc10odo[i] - this->params.soc10odo[i + 1]) : -1;
+      diffTime = (this->params.soc10time[i + 1] != -1 && this->params.soc10time[i] != -1) ? (this->params.soc10time[i] - this->params.soc10time[i + 1]) : -1;
       if (diffCec != 0) {
-        sprintf(this->tmpStr1, "+%01.01f", diffCec);
+        this->formatNumber(this->tmpStr1, diffCec, 1, "+");
         this->spr.drawString(this->tmpStr1, 128, zeroY + ((12 - i) * 15), 2);
         diffCec0to5 = (i == 0) ? diffCec : diffCec0to5;
       }
       if (diffCed != 0) {
-        sprintf(this->tmpStr1, "%01.01f", diffCed);
+        this->formatNumber(this->tmpStr1, diffCed, 1);
         this->spr.drawString(this->tmpStr1, 80, zeroY + ((12 - i) * 15), 2);
         diffCed0to5 = (i == 0) ? diffCed : diffCed0to5;
       }
       if (diffOdo != -1) {
-        sprintf(this->tmpStr1, "%01.00f", this->liveData->km2distance(diffOdo));
+        this->formatNumber(this->tmpStr1, this->liveData->km2distance(diffOdo), 0);
         this->spr.drawString(this->tmpStr1, 160, zeroY + ((12 - i) * 15), 2);
         diffOdo0to5 = (i == 0) ? diffOdo : diffOdo0to5;
         if (diffTime > 0) {
-          sprintf(this->tmpStr1, "%01.01f", this->liveData->km2distance(diffOdo) / (diffTime / 3600));
+          this->formatNumber(this->tmpStr1, this->liveData->km2distance(diffOdo) / (diffTime / 3600), 1);
           this->spr.drawString(this->tmpStr1, 310, zeroY + ((12 - i) * 15), 2);
         }
       }
       if (diffOdo > 0 && diffCed != 0) {
-        sprintf(this->tmpStr1, "%01.1f", (-diffCed * 100.0 / this->liveData->km2distance(diffOdo)));
+        this->formatNumber(this->tmpStr1, (-diffCed * 100.0 / this->liveData->km2distance(diffOdo)), 1);
         this->spr.drawString(this->tmpStr1, 224, zeroY + ((12 - i) * 15), 2);
       }
     }
 
-    if (diffOdo == -1 && this->liveData->params.soc10odo[i] != -1) {
-      sprintf(this->tmpStr1, "%01.00f", this->liveData->km2distance(this->liveData->params.soc10odo[i]));
+    if (diffOdo == -1 && this->params.soc10odo[i] != -1) {
+      this->formatNumber(this->tmpStr1, this->liveData->km2distance(this->params.soc10odo[i]), 0);
       this->spr.drawString(this->tmpStr1, 160, zeroY + ((12 - i) * 15), 2);
     }
   }
@@ -773,15 +1038,15 @@ void Board320_240::drawSceneSoc10Table() {
 
   this->spr.drawString("TOT.", 32, zeroY + (14 * 15), 2);
   diffCed = (lastCed != -1 && firstCed != -1) ? firstCed - lastCed + diffCed0to5 : 0;
-  sprintf(this->tmpStr1, "%01.01f", diffCed);
+  this->formatNumber(this->tmpStr1, diffCed, 1);
   this->spr.drawString(this->tmpStr1, 80, zeroY + (14 * 15), 2);
   diffCec = (lastCec != -1 && firstCec != -1) ? lastCec - firstCec + diffCec0to5 : 0;
-  sprintf(this->tmpStr1, "+%01.01f", diffCec);
+  this->formatNumber(this->tmpStr1, diffCec, 1, "+");
   this->spr.drawString(this->tmpStr1, 128, zeroY + (14 * 15), 2);
   diffOdo = (lastOdo != -1 && firstOdo != -1) ? lastOdo - firstOdo + diffOdo0to5 : 0;
-  sprintf(this->tmpStr1, "%01.00f", this->liveData->km2distance(diffOdo));
+  this->formatNumber(this->tmpStr1, this->liveData->km2distance(diffOdo), 0);
   this->spr.drawString(this->tmpStr1, 160, zeroY + (14 * 15), 2);
-  sprintf(this->tmpStr1, "AVAIL.CAP: %01.01f kWh", -diffCed - diffCec);
+  this->formatNumber(this->tmpStr1, -diffCed - diffCec, 1, "AVAIL.CAP: ", " kWh");
   this->spr.drawString(this->tmpStr1, 310, zeroY + (14 * 15), 2);
 }
 
@@ -802,7 +1067,7 @@ void Board320_240::drawSceneDebug() {
   this->spr.drawString(this->liveData->commandRequest, 256, 0, 2);
   this->spr.setTextDatum(TR_DATUM);
 
-  for (int i = 0; i < debugLastString.length() / 2; i++) {
+  for (unsigned int i = 0; i < debugLastString.length() / 2; i++) {
     chHex = debugLastString.substring(i * 2, (i * 2) + 2);
     chHex2 = debugPreviousString.substring(i * 2, (i * 2) + 2);
     this->spr.setTextColor(((chHex.equals(chHex2)) ?  TFT_SILVER : TFT_GREEN), TFT_TEMP);
@@ -817,15 +1082,56 @@ void Board320_240::drawSceneDebug() {
     this->spr.drawString(this->tmpStr1, posx + 4, posy + 13, 2);
   }
 
-  debugPreviousString = debugLastString;
+  // Last frame times per scene (draw/push ms)
+  this->spr.setTextDatum(TL_DATUM);
+  this->spr.setTextColor(TFT_SILVER, TFT_TEMP);
+  // Command watchdog timeouts/retries/skips, last stall
+  char watchdogStr[48];
+  sprintf(watchdogStr, "TO:%lu RT:%lu SK:%lu", (unsigned long)this->liveData->commandTimeouts, (unsigned long)this->liveData->commandRetries, (unsigned long)this->liveData->commandSkips);
+  this->spr.drawString(watchdogStr, 0, 192, 1);
+  sprintf(this->tmpStr1, "STALL:%lums", this->liveData->commandStallMs);
+  this->spr.drawString(this->tmpStr1, 212, 192, 1);
+  // Header switches in last loop / redundant ATSH not sent
+  sprintf(watchdogStr, "SH:%u EL:%lu", this->liveData->atshSwitchesLastLoop, (unsigned long)this->liveData->atshElided);
+  this->spr.drawString(watchdogStr, 130, 192, 1);
+  // Multi frame responses parsed before prompt, last prompt delay
+  sprintf(watchdogStr, "EC:%lu PL:%lums", (unsigned long)this->liveData->responseEarlyCompleted, this->liveData->promptLatencyMs);
+  this->spr.drawString(watchdogStr, 212, 176, 1);
+  // Fast flow control mode of adapter, fallbacks after truncated response
+  sprintf(watchdogStr, "FC:%d FB:%lu", this->liveData->flowControlMode, (unsigned long)this->liveData->flowControlFallbacks);
+  this->spr.drawString(watchdogStr, 130, 176, 1);
+  // Monitor mode frames, consecutive failed bursts (backoff)
+  sprintf(watchdogStr, "MA:%lu MF:%u PF:%lu", (unsigned long)this->liveData->monitorFrames, this->liveData->monitorFailures, (unsigned long)this->liveData->periodicFallbacks);
+  this->spr.drawString(watchdogStr, 0, 176, 1);
+  for (uint8_t i = SCREEN_DASH; i <= SCREEN_DEBUG; i++) {
+    snprintf(watchdogStr, sizeof(watchdogStr), "%d:%lu/%lums", i, this->sceneDrawUs[i] / 1000, this->scenePushUs[i] / 1000);
+    this->spr.drawString(watchdogStr, ((i - SCREEN_DASH) % 3) * 106, 208 + ((i - SCREEN_DASH) / 3) * 16, 1);
+  }
 }
 
 /**
-   Modify caption
+  Signals (values) consumed by screen, only these are requested from car
 */
-String Board320_240::menuItemCaption(int16_t menuItemId, String title) {
+uint32_t Board320_240::sceneSignals(byte screen) {
+
+  switch (screen) {
+    case SCREEN_BLANK: return 0;
+    case SCREEN_AUTO: return this->sceneSignals(SCREEN_DASH) | this->sceneSignals(SCREEN_SPEED) | this->sceneSignals(SCREEN_CHARGING);
+    case SCREEN_DASH: return SIGNAL_TIRES | SIGNAL_BATTERY | SIGNAL_SOC | SIGNAL_SPEED | SIGNAL_AUX | SIGNAL_AIRCON;
+    case SCREEN_SPEED: return SIGNAL_SPEED | SIGNAL_BATTERY | SIGNAL_SOC | SIGNAL_ODO | SIGNAL_BRAKE_LIGHTS;
+    case SCREEN_CELLS: return SIGNAL_BATTERY | SIGNAL_SOC | SIGNAL_CELLS;
+    case SCREEN_CHARGING: return SIGNAL_SPEED | SIGNAL_BATTERY | SIGNAL_SOC | SIGNAL_COOLANT | SIGNAL_AIRCON;
+    case SCREEN_SOC10: return SIGNAL_BATTERY | SIGNAL_SOC | SIGNAL_ODO;
+    default: return SIGNAL_ALL; // debug screen
+  }
+}
 
-  String prefix = "", suffix = "";
+/**
+   Modify caption (formatted into fixed buffer)
+*/
+const char* Board320_240::menuItemCaption(int16_t menuItemId, const char* title) {
+
+  const char* suffix = NULL;
 
   if (menuItemId == 10) // Version
     suffix = APP_VERSION;
@@ -837,9 +1143,14 @@ String Board320_240::menuItemCaption(int16_t menuItemId, String title) {
   if (menuItemId == 403) // pressure
     suffix = (this->liveData->settings.pressureUnit == 'b') ? "[bar]" : "[psi]";
 
-  title = ((prefix == "") ? "" : prefix + " ") + title + ((suffix == "") ? "" : " " + suffix);
+  if (suffix == NULL)
+    return title;
 
-  return title;
+  strlcpy(this->menuCaptionStr, title, MENU_CAPTION_SIZE);
+  strlcat(this->menuCaptionStr, " ", MENU_CAPTION_SIZE);
+  strlcat(this->menuCaptionStr, suffix, MENU_CAPTION_SIZE);
+
+  return this->menuCaptionStr;
 }
 
 /**
@@ -847,38 +1158,41 @@ String Board320_240::menuItemCaption(int16_t menuItemId, String title) {
 */
 void Board320_240::showMenu() {
 
-  uint16_t posY = 0, tmpCurrMenuItem = 0;
-
   this->liveData->menuVisible = true;
-Serial.println("A");
-  this->spr.fillSprite(TFT_BLACK);
-  this->spr.setTextDatum(TL_DATUM);
-  this->spr.setFreeFont(&Roboto_Thin_24);
+  this->drawnScreen = SCREEN_BLANK;
 
-Serial.println("B");
-  // Page scroll
+  // Page scroll (drawMenu is called for each strip band)
+  this->spr.setFreeFont(&Roboto_Thin_24);
   uint8_t visibleCount = (int)(this->tft.height() / this->spr.fontHeight());
   if (this->liveData->menuItemSelected >= this->liveData->menuItemOffset + visibleCount)
     this->liveData->menuItemOffset = this->liveData->menuItemSelected - visibleCount + 1;
   if (this->liveData->menuItemSelected < this->liveData->menuItemOffset)
     this->liveData->menuItemOffset = this->liveData->menuItemSelected;
-Serial.println("C");
-
-  // Print items
-  for (uint16_t i = 0; i < this->liveData->menuItemsCount; ++i) {
-    if (this->liveData->menuCurrent == this->liveData->menuItems[i].parentId) {
-Serial.println("D");
-      if (tmpCurrMenuItem >= this->liveData->menuItemOffset) {
-        this->spr.fillRect(0, posY, 320, this->spr.fontHeight() + 2, (this->liveData->menuItemSelected == tmpCurrMenuItem) ? TFT_DARKGREEN2 : TFT_BLACK);
-        this->spr.setTextColor((this->liveData->menuItemSelected == tmpCurrMenuItem) ? TFT_WHITE : TFT_WHITE, (this->liveData->menuItemSelected == tmpCurrMenuItem) ? TFT_DARKGREEN2 : TFT_BLACK);
-        this->spr.drawString(this->menuItemCaption(this->liveData->menuItems[i].id, this->liveData->menuItems[i].title), 0, posY + 2, GFXFF);
-        posY += this->spr.fontHeight();
-      }
-      tmpCurrMenuItem++;
-    }
-  }
 
-  this->spr.pushSprite(0, 0);
+  this->renderSprite(&Board320_240::drawMenu);
+}
+
+/**
+  Draw menu items into sprite
+*/
+void Board320_240::drawMenu() {
+
+  uint16_t posY = 0;
+  MENU_ITEM* menuItem;
+
+  this->spr.fillSprite(TFT_BLACK);
+  this->spr.setTextDatum(TL_DATUM);
+  this->spr.setFreeFont(&Roboto_Thin_24);
+
+  // Print visible items of current level
+  uint8_t visibleCount = (int)(this->tft.height() / this->spr.fontHeight());
+  for (uint16_t i = this->liveData->menuItemOffset; i < this->liveData->menuChildrenCount && i < this->liveData->menuItemOffset + visibleCount + 1; ++i) {
+    menuItem = this->liveData->menuChild(i);
+    this->spr.fillRect(0, posY, 320, this->spr.fontHeight() + 2, (this->liveData->menuItemSelected == i) ? TFT_DARKGREEN2 : TFT_BLACK);
+    this->spr.setTextColor(TFT_WHITE, (this->liveData->menuItemSelected == i) ? TFT_DARKGREEN2 : TFT_BLACK);
+    this->spr.drawString(this->menuItemCaption(menuItem->id, menuItem->title), 0, posY + 2, GFXFF);
+    posY += this->spr.fontHeight();
+  }
 }
 
 /**
@@ -887,7 +1201,7 @@ Serial.println("D");
 void Board320_240::hideMenu() {
 
   this->liveData->menuVisible = false;
-  this->liveData->menuCurrent = 0;
+  this->liveData->setMenuCurrent(0);
   this->liveData->menuItemSelected = 0;
   this->redrawScreen();
 }
@@ -898,12 +1212,7 @@ void Board320_240::hideMenu() {
 void Board320_240::menuMove(bool forward) {
 
   if (forward) {
-    uint16_t tmpCount = 0;
-    for (uint16_t i = 0; i < this->liveData->menuItemsCount; ++i) {
-      if (this->liveData->menuCurrent == this->liveData->menuItems[i].parentId) {
-        tmpCount++;
-      }
-    }
+    uint16_t tmpCount = this->liveData->menuChildrenCount;
     this->liveData->menuItemSelected = (this->liveData->menuItemSelected >= tmpCount - 1 ) ? tmpCount - 1 : this->liveData->menuItemSelected + 1;
   } else {
     this->liveData->menuItemSelected = (this->liveData->menuItemSelected <= 0) ? 0 : this->liveData->menuItemSelected - 1;
@@ -917,17 +1226,10 @@ void Board320_240::menuMove(bool forward) {
 void Board320_240::menuItemClick() {
 
   // Locate menu item for meta data
-  MENU_ITEM tmpMenuItem;
-  uint16_t tmpCurrMenuItem = 0;
-  for (uint16_t i = 0; i < this->liveData->menuItemsCount; ++i) {
-    if (this->liveData->menuCurrent == this->liveData->menuItems[i].parentId) {
-      if (this->liveData->menuItemSelected == tmpCurrMenuItem) {
-        tmpMenuItem = this->liveData->menuItems[i];
-        break;
-      }
-      tmpCurrMenuItem++;
-    }
-  }
+  MENU_ITEM* menuItem = this->liveData->menuChild(this->liveData->menuItemSelected);
+  if (menuItem == NULL)
+    return;
+  MENU_ITEM& tmpMenuItem = *menuItem;
 
   // Exit menu, parent level menu, open item
   if (this->liveData->menuItemSelected == 0) {
@@ -937,7 +1239,7 @@ void Board320_240::menuItemClick() {
       this->redrawScreen();
     } else {
       // Parent menu
-      this->liveData->menuCurrent = tmpMenuItem.targetParentId;
+      this->liveData->setMenuCurrent(tmpMenuItem.targetParentId);
       this->showMenu();
     }
     return;
@@ -1001,7 +1303,7 @@ void Board320_240::menuItemClick() {
       case 11: this->shutdownDevice(); return;
       default:
         // Submenu
-        this->liveData->menuCurrent = tmpMenuItem.id;
+        this->liveData->setMenuCurrent(tmpMenuItem.id);
         this->liveData->menuItemSelected = 0;
         this->showMenu();
         return;
@@ -1012,6 +1314,27 @@ void Board320_240::menuItemClick() {
   }
 }
 
+/**
+  Draw scene into sprite
+*/
+void Board320_240::drawScene(byte scene) {
+
+  switch (scene) {
+    // 2. Main screen
+    case SCREEN_DASH: this->drawSceneMain(); break;
+    // 3. Big speed + kwh/100km
+    case SCREEN_SPEED: this->drawSceneSpeed(); break;
+    // 4. Battery cells
+    case SCREEN_CELLS: this->drawSceneBatteryCells(); break;
+    // 5. Charging graph
+    case SCREEN_CHARGING: this->drawSceneChargingGraph(); break;
+    // 6. SOC10% table (CEC-CED)
+    case SCREEN_SOC10: this->drawSceneSoc10Table(); break;
+    // 7. DEBUG SCREEN
+    case SCREEN_DEBUG: this->drawSceneDebug(); break;
+  }
+}
+
 /**
   Redraw screen
 */
@@ -1021,77 +1344,117 @@ void Board320_240::redrawScreen() {
     return;
   }
 
-  // Lights not enabled
-  if (!this->testDataMode && this->liveData->params.forwardDriveMode && !this->liveData->params.headLights && !this->liveData->params.dayLights) {
-    this->spr.fillSprite(TFT_RED);
-    this->spr.setFreeFont(&Orbitron_Light_32);
-    this->spr.setTextColor(TFT_WHITE, TFT_RED);
-    this->spr.setTextDatum(MC_DATUM);
-    this->spr.drawString("! LIGHTS OFF !", 160, 120, GFXFF);
-    this->spr.pushSprite(0, 0);
+  // Poll only values visible on current screen
+  this->liveData->subscribeSignals(this->sceneSignals(this->displayScreen));
+
+  // Consistent values of last poll cycle
+  this->liveData->readParams(this->params);
 
+  // Lights not enabled
+  if (!this->testDataMode && this->params.forwardDriveMode && !this->params.headLights && !this->params.dayLights) {
+    this->drawnScreen = SCREEN_BLANK;
+    this->fullRedraw = true;
+    this->renderSprite(&Board320_240::drawLightsOff);
     return;
   }
 
-  this->spr.fillSprite(TFT_BLACK);
+  // Only dashboard is built from cells, other screens are redrawn whole (always in strip mode)
+  byte scene = this->displayScreen;
+  if (scene == SCREEN_AUTO)
+    scene = (this->params.speedKmh > 5) ? SCREEN_SPEED : (this->params.batPowerKw > 1) ? SCREEN_CHARGING : SCREEN_DASH;
+  bool bleMessage = (!this->liveData->bleConnected && this->liveData->bleConnect);
+  this->fullRedraw = (scene != SCREEN_DASH || scene != this->drawnScreen || bleMessage || this->displayScreenSpeedHud || this->stripLines != 0);
+  this->drawnScreen = scene;
+  this->dirtyRectsCount = 0;
 
-  // 1. Auto mode = >5kpm Screen 3 - speed, other wise basic Screen2 - Main screen, if charging then Screen 5 Graph
-  if (this->displayScreen == SCREEN_AUTO) {
-    if (this->liveData->params.speedKmh > 5) {
-      if (this->displayScreenAutoMode != 3) {
-        this->displayScreenAutoMode = 3;
-      }
-      this->drawSceneSpeed();
-    } else if (this->liveData->params.batPowerKw > 1) {
-      if (this->displayScreenAutoMode != 5) {
-        this->displayScreenAutoMode = 5;
-      }
-      this->drawSceneChargingGraph();
-    } else {
-      if (this->displayScreenAutoMode != 2) {
-        this->displayScreenAutoMode = 2;
-      }
-      this->drawSceneMain();
-    }
-  }
-  // 2. Main screen
-  if (this->displayScreen == SCREEN_DASH) {
-    this->drawSceneMain();
-  }
-  // 3. Big speed + kwh/100km
-  if (this->displayScreen == SCREEN_SPEED) {
-    this->drawSceneSpeed();
-  }
-  // 4. Battery cells
-  if (this->displayScreen == SCREEN_CELLS) {
-    this->drawSceneBatteryCells();
-  }
-  // 5. Charging graph
-  if (this->displayScreen == SCREEN_CHARGING) {
-    this->drawSceneChargingGraph();
-  }
-  // 6. SOC10% table (CEC-CED)
-  if (this->displayScreen == SCREEN_SOC10) {
-    this->drawSceneSoc10Table();
+  // Auto mode = >5kpm speed screen, if charging then graph, otherwise main screen
+  if (this->displayScreen == SCREEN_AUTO)
+    this->displayScreenAutoMode = scene;
+
+  // Speed HUD is drawn directly to display
+  if (this->displayScreenSpeedHud) {
+    this->drawScene(scene);
+    return;
   }
-  // 7. DEBUG SCREEN
-  if (this->displayScreen == SCREEN_DEBUG) {
-    this->drawSceneDebug();
+
+  unsigned long drawStartUs = micros();
+  this->renderSprite(&Board320_240::drawFrame);
+  this->sceneDrawUs[scene] = micros() - drawStartUs - this->pushUs;
+  this->scenePushUs[scene] = this->pushUs;
+
+  // Per frame state is changed here, draw functions are called for each strip band
+  if (scene == SCREEN_DEBUG)
+    this->debugPreviousString = this->debugLastString;
+}
+
+/**
+  Draw current scene into sprite
+*/
+void Board320_240::drawFrame() {
+
+  if (this->fullRedraw)
+    this->spr.fillSprite(TFT_BLACK);
+
+  this->drawScene(this->drawnScreen);
+
+  // BLE not connected
+  if (!this->liveData->bleConnected && this->liveData->bleConnect) {
+    // Print message
+    this->spr.setTextSize(1);
+    this->spr.setTextColor(TFT_WHITE, TFT_BLACK);
+    this->spr.setTextDatum(TL_DATUM);
+    this->spr.drawString("BLE4 OBDII not connected...", 0, 180, 2);
+    this->spr.drawString("Press middle button to menu.", 0, 200, 2);
+    this->spr.drawString(APP_VERSION, 0, 220, 2);
   }
+}
 
-  if (!this->displayScreenSpeedHud) {
-    // BLE not connected
-    if (!this->liveData->bleConnected && this->liveData->bleConnect) {
-      // Print message
-      this->spr.setTextSize(1);
-      this->spr.setTextColor(TFT_WHITE, TFT_BLACK);
-      this->spr.setTextDatum(TL_DATUM);
-      this->spr.drawString("BLE4 OBDII not connected...", 0, 180, 2);
-      this->spr.drawString("Press middle button to menu.", 0, 200, 2);
-      this->spr.drawString(APP_VERSION, 0, 220, 2);
+/**
+  Draw lights off warning into sprite
+*/
+void Board320_240::drawLightsOff() {
+
+  this->spr.fillSprite(TFT_RED);
+  this->spr.setFreeFont(&Orbitron_Light_32);
+  this->spr.setTextColor(TFT_WHITE, TFT_RED);
+  this->spr.setTextDatum(MC_DATUM);
+  this->spr.drawString("! LIGHTS OFF !", 160, 120, GFXFF);
+}
+
+/**
+  Draw into sprite and push it to display
+  Strip mode (no PSRAM) - draw function is called for each band of stripLines, band is pushed and reused
+*/
+void Board320_240::renderSprite(void (Board320_240::*draw)()) {
+
+  unsigned long pushStartUs;
+
+  this->pushUs = 0;
+  this->hudDrawn = false;
+
+  // Whole screen sprite
+  if (this->stripLines == 0) {
+    (this->*draw)();
+    pushStartUs = micros();
+    if (this->fullRedraw) {
+      this->spr.pushSprite(0, 0);
+    } else {
+      // Push changed cells only
+      for (uint8_t i = 0; i < this->dirtyRectsCount; i++)
+        this->spr.pushSprite(this->dirtyRects[i].x, this->dirtyRects[i].y, this->dirtyRects[i].x, this->dirtyRects[i].y, this->dirtyRects[i].w, this->dirtyRects[i].h);
     }
+    this->pushUs = micros() - pushStartUs;
+    return;
+  }
 
-    this->spr.pushSprite(0, 0);
+  // Bands, scene code is clipped by viewport shifted to band position
+  for (int32_t y = 0; y < 240; y += this->stripLines) {
+    this->spr.setViewport(0, -y, 320, 240);
+    (this->*draw)();
+    this->spr.resetViewport();
+    pushStartUs = micros();
+    this->spr.pushSprite(0, y);
+    this->pushUs += micros() - pushStartUs;
   }
 }
 
@@ -1102,6 +1465,7 @@ void Board320_240::loadTestData() {
 
   this->testDataMode = true; // skip lights off message
   this->carInterface->loadTestData();
+  this->liveData->publishParams();
   this->redrawScreen();
 }
 
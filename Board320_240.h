@@ -16,6 +16,50 @@
 #include <TFT_eSPI.h>
 #include "BoardInterface.h"
 
+// Dirty-region rendering (big cells 4x4, small cells 4x8)
+#define CELL_CACHE_SIZE 48
+#define CELL_SMALL_OFFSET 16
+#define DIRTY_RECTS_SIZE 16
+#define CHARGING_CURVES_MAX 32
+// Band height of strip rendering without PSRAM (16bpp 320xSTRIP_LINES sprite), 0 - 8bpp full screen sprite
+#define STRIP_LINES 40
+// HUD regions (speed, power, soc, cold gate, brake lights), 1bpp sprites for font 8 digits
+#define HUD_CACHE_SIZE 5
+#define HUD_BIG_LINES 150
+#define HUD_SMALL_LINES 75
+// Glyph cache of numeric fonts 7/8 (font + size slots, cached characters)
+#define GLYPH_CACHE_FONTS 4
+#define GLYPH_CACHE_CHARS "0123456789.- "
+#define GLYPH_CACHE_CHARS_COUNT 13
+
+typedef struct {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+} DIRTY_RECT;
+
+// Horizontal run of foreground pixels in glyph
+typedef struct {
+  uint8_t y;
+  uint8_t x;
+  uint8_t len;
+} GLYPH_RUN;
+
+typedef struct {
+  uint8_t width;
+  uint16_t runsFrom;
+  uint16_t runsCount;
+} GLYPH;
+
+typedef struct {
+  uint8_t font;
+  uint8_t size;
+  uint8_t height;
+  GLYPH glyphs[GLYPH_CACHE_CHARS_COUNT];
+  GLYPH_RUN* runs;
+} GLYPH_FONT;
+
 class Board320_240 : public BoardInterface {
 
   private:
@@ -26,6 +70,46 @@ class Board320_240 : public BoardInterface {
     char tmpStr2[20];
     char tmpStr3[20];
     char tmpStr4[20];
+    char menuCaptionStr[MENU_CAPTION_SIZE];
+    // Strip rendering (0 - full screen sprite)
+    int32_t stripLines = 0;
+    unsigned long pushUs = 0;
+    void renderSprite(void (Board320_240::*draw)());
+    void drawFrame();
+    void drawLightsOff();
+    void drawMenu();
+    // HUD region sprites
+    TFT_eSprite hudBigSpr = TFT_eSprite(&tft);
+    TFT_eSprite hudSmallSpr = TFT_eSprite(&tft);
+    bool hudDrawn = false;
+    uint32_t hudCache[HUD_CACHE_SIZE];
+    bool drawHudRegion(uint8_t region, TFT_eSprite& regionSpr, const char* text, uint8_t textSize, int32_t posY);
+    // Dirty-region rendering
+    bool fullRedraw = true;
+    byte drawnScreen = SCREEN_BLANK;
+    uint32_t cellCache[CELL_CACHE_SIZE];
+    DIRTY_RECT dirtyRects[DIRTY_RECTS_SIZE];
+    uint8_t dirtyRectsCount = 0;
+    uint32_t hashText(uint32_t hash, const char* text);
+    bool isCellDirty(uint8_t cell, uint32_t hash, int32_t x, int32_t y, int32_t w, int32_t h);
+    // Pre-rasterized digits of fonts 7/8
+    GLYPH_FONT glyphFonts[GLYPH_CACHE_FONTS];
+    uint8_t glyphFontsCount = 0;
+    GLYPH_FONT* glyphFont(uint8_t font, uint8_t size);
+    bool drawCachedString(TFT_eSprite& target, const char* text, int32_t x, int32_t y, uint8_t font, uint8_t size, uint8_t datum, uint16_t color);
+    // Number formatting without float printf
+    char* formatNumber(char* buf, float value, uint8_t decimals, const char* prefix = "", const char* suffix = "", uint8_t intDigits = 1);
+    char* formatTemperature(char* buf, float celsius, const char* prefix = "", const char* unitSeparator = NULL);
+    // Charging curves pixel endpoints (x0, y0, x1, y1)
+    const CHARGING_CURVE_LINE* chargingCurvesCached = NULL;
+    int chargingCurvesZeroX = 0;
+    int chargingCurvesZeroY = 0;
+    int chargingCurvesMulX = 0;
+    int chargingCurvesMulY = 0;
+    int16_t chargingCurvesPx[CHARGING_CURVES_MAX][4];
+    // Last frame times per scene
+    unsigned long sceneDrawUs[SCREEN_DEBUG + 1] = {0};
+    unsigned long scenePushUs[SCREEN_DEBUG + 1] = {0};
   public:
     bool invertDisplay = false;
     byte pinButtonLeft = 0;
@@ -53,8 +137,10 @@ class Board320_240 : public BoardInterface {
     void drawSceneChargingGraph();
     void drawSceneSoc10Table();
     void drawSceneDebug();
+    void drawScene(byte scene);
+    uint32_t sceneSignals(byte screen);
     // Menu
-    String menuItemCaption(int16_t menuItemId, String title);
+    const char* menuItemCaption(int16_t menuItemId, const char* title);
     void showMenu() override;
     void hideMenu() override;
     void menuMove(bool forward);
@@ -3,79 +3,153 @@
 
 #include "CarHyundaiIoniq.h"
 
-#define commandQueueCountHyundaiIoniq 25
+#define commandQueueCountHyundaiIoniq (sizeof(commandQueueHyundaiIoniq) / sizeof(commandQueueHyundaiIoniq[0]))
 #define commandQueueLoopFromHyundaiIoniq 8
+#define commandScheduleCountHyundaiIoniq 12
+#define signalsCountHyundaiIoniq 38
+
+/**
+   Refresh rates (ms) and provided signals, power/speed are requested every loop
+*/
+const COMMAND_SCHEDULE commandScheduleHyundaiIoniq[commandScheduleCountHyundaiIoniq] = {
+  {"ATSH7E4", "2101", 0, SIGNAL_BATTERY},     // power
+  {"ATSH7E4", "2102", 10000, SIGNAL_CELLS},
+  {"ATSH7E4", "2103", 10000, SIGNAL_CELLS},
+  {"ATSH7E4", "2104", 10000, SIGNAL_CELLS},
+  {"ATSH7E4", "2105", 5000, SIGNAL_SOC | SIGNAL_CELLS}, // soc, soh, heater, module temps
+  {"ATSH7E4", "2106", 10000, SIGNAL_COOLANT},
+  {"ATSH7E2", "2101", 0, SIGNAL_SPEED},
+  {"ATSH7E2", "2102", 5000, SIGNAL_AUX},
+  {"ATSH7B3", "220100", 10000, SIGNAL_AIRCON}, // in/out temp
+  {"ATSH7B3", "220102", 10000, SIGNAL_AIRCON}, // coolant temp
+  {"ATSH7A0", "22c00b", 30000, SIGNAL_TIRES},
+  {"ATSH7C6", "22B002", 10000, SIGNAL_ODO},
+};
+
+/**
+   Plain values (raw * scale + offset), derived values are computed in parseRowMerged
+   Pressure bar = raw * 0.2 / 14.503773800722
+*/
+const SIGNAL_DEF signalsHyundaiIoniq[signalsCountHyundaiIoniq] = {
+  // VMCU 7E2
+  {COMMAND_KEY(0x7E2, 0x2101), PARAM(speedKmh), 16, 2, false, 0.0155, 0, 1, SIGNAL_MATCH_ANY, 0}, // / 100.0 *1.609 = real to gps is 1.750
+  {COMMAND_KEY(0x7E2, 0x2102), PARAM(auxPerc), 25, 1, false, 1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E2, 0x2102), PARAM(auxCurrentAmp), 23, 2, true, -0.001, 0, 1, SIGNAL_MATCH_ANY, 0},
+  // Cluster module 7c6
+  {COMMAND_KEY(0x7C6, 0x22B002), PARAM(odoKm), 9, 3, false, 1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  // Aircon 7b3
+  {COMMAND_KEY(0x7B3, 0x220100), PARAM(indoorTemperature), 8, 1, false, 0.5, -40, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7B3, 0x220100), PARAM(outdoorTemperature), 9, 1, false, 0.5, -40, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7B3, 0x220102), PARAM(coolantTemp1C), 7, 1, false, 0.5, -40, 1, 6, 0x00},
+  {COMMAND_KEY(0x7B3, 0x220102), PARAM(coolantTemp2C), 8, 1, false, 0.5, -40, 1, 6, 0x00},
+  // BMS 7e4
+  {COMMAND_KEY(0x7E4, 0x2101), PARAM(cumulativeEnergyChargedKWh), 40, 4, false, 0.1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x2101), PARAM(cumulativeEnergyDischargedKWh), 44, 4, false, 0.1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x2101), PARAM(availableChargePower), 8, 2, false, 0.01, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x2101), PARAM(availableDischargePower), 10, 2, false, 0.01, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x2101), PARAM(isolationResistanceKOhm), 59, 2, true, 1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x2101), PARAM(batFanStatus), 29, 1, false, 1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x2101), PARAM(batFanFeedbackHz), 30, 1, false, 1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x2101), PARAM(auxVoltage), 31, 1, false, 0.1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x2101), PARAM(batPowerAmp), 12, 2, true, -0.1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x2101), PARAM(batVoltage), 14, 2, false, 0.1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x2101), PARAM(batCellMaxV), 25, 1, false, 0.02, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x2101), PARAM(batCellMinV), 27, 1, false, 0.02, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x2101), PARAM(batModuleTempC[0]), 18, 1, true, 1, 0, 5, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x2101), PARAM(batInletC), 24, 1, true, 1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x2102), PARAM(cellVoltage[0]), 6, 1, false, 0.02, 0, 32, 5, 0xFF},
+  {COMMAND_KEY(0x7E4, 0x2103), PARAM(cellVoltage[32]), 6, 1, false, 0.02, 0, 32, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x2104), PARAM(cellVoltage[64]), 6, 1, false, 0.02, 0, 32, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x2105), PARAM(sohPerc), 27, 2, false, 0.1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x2105), PARAM(socPerc), 33, 1, false, 0.5, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x2105), PARAM(batModuleTempC[5]), 11, 1, true, 1, 0, 7, SIGNAL_MATCH_ANY, 0}, // remaining battery modules
+  {COMMAND_KEY(0x7E4, 0x2105), PARAM(batHeaterC), 25, 1, true, 1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x2106), PARAM(coolingWaterTempC), 7, 1, false, 1, 0, 1, SIGNAL_MATCH_ANY, 0}, // IONIQ FAILED
+  // TPMS 7a0
+  {COMMAND_KEY(0x7A0, 0x22C00B), PARAM(tireFrontLeftPressureBar), 7, 1, false, 1 / 72.51886900361, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7A0, 0x22C00B), PARAM(tireFrontRightPressureBar), 11, 1, false, 1 / 72.51886900361, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7A0, 0x22C00B), PARAM(tireRearRightPressureBar), 15, 1, false, 1 / 72.51886900361, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7A0, 0x22C00B), PARAM(tireRearLeftPressureBar), 19, 1, false, 1 / 72.51886900361, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7A0, 0x22C00B), PARAM(tireFrontLeftTempC), 8, 1, false, 1, -50, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7A0, 0x22C00B), PARAM(tireFrontRightTempC), 12, 1, false, 1, -50, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7A0, 0x22C00B), PARAM(tireRearRightTempC), 16, 1, false, 1, -50, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7A0, 0x22C00B), PARAM(tireRearLeftTempC), 20, 1, false, 1, -50, 1, SIGNAL_MATCH_ANY, 0},
+};
+// Each command has at least one row, index of commands fits
+static_assert(signalsCountHyundaiIoniq <= SIGNAL_INDEX_SIZE, "signal rows exceed SIGNAL_INDEX_SIZE");
+
+// Broadcast ids (monitor mode), ESC WHL_SPD11 - wheel speeds (id of Hyundai/Kia C-CAN, not verified on Ioniq OBD port)
+constexpr uint16_t monitorIdsHyundaiIoniq[] = {
+  0x386,
+};
+#define monitorIdsCountHyundaiIoniq (sizeof(monitorIdsHyundaiIoniq) / sizeof(monitorIdsHyundaiIoniq[0]))
+
+// Commands in flash, terminated by \r (sent as is)
+constexpr const char* commandQueueHyundaiIoniq[] = {
+  "AT Z\r",      // Reset all
+  "AT I\r",      // Print the version ID
+  "AT E0\r",     // Echo off
+  "AT L0\r",     // Linefeeds off
+  "AT S0\r",     // Printing of spaces on
+  "AT SP 6\r",   // Select protocol to ISO 15765-4 CAN (11 bit ID, 500 kbit/s)
+  //"AT AL",     // Allow Long (>7 byte) messages
+  //"AT AR",     // Automatically receive
+  //"AT H1",     // Headers on (debug only)
+  //"AT D1",     // Display of the DLC on
+  //"AT CAF0",   // Automatic formatting off
+  "AT DP\r",
+  "AT ST16\r",
+
+  // Loop from (HYUNDAI IONIQ)
+  // BMS
+  "ATSH7E4\r",
+  "2101\r",   // power kw, ...
+  "2102\r",   // cell voltages, screen 3 only
+  "2103\r",   // cell voltages, screen 3 only
+  "2104\r",   // cell voltages, screen 3 only
+  "2105\r",   // soh, soc, ..
+  "2106\r",   // cooling water temp
+
+  // VMCU
+  "ATSH7E2\r",
+  "2101\r",     // speed, ...
+  "2102\r",     // aux, ...
+
+  //"ATSH7Df",
+  //"2106",
+  //"220106",
+
+  // Aircondition
+  // IONIQ OK
+  "ATSH7B3\r",
+  "220100\r",   // in/out temp
+  "220102\r",   // coolant temp1, 2
+
+  // BCM / TPMS
+  // IONIQ OK
+  "ATSH7A0\r",
+  "22c00b\r",   // tire pressure/temp
+
+  // CLUSTER MODULE
+  // IONIQ OK
+  "ATSH7C6\r",
+  "22B002\r",   // odo
+};
 
 /**
    activatethis->liveData->commandQueue
 */
 void CarHyundaiIoniq::activateCommandQueue() {
 
-  String commandQueueHyundaiIoniq[commandQueueCountHyundaiIoniq] = {
-    "AT Z",      // Reset all
-    "AT I",      // Print the version ID
-    "AT E0",     // Echo off
-    "AT L0",     // Linefeeds off
-    "AT S0",     // Printing of spaces on
-    "AT SP 6",   // Select protocol to ISO 15765-4 CAN (11 bit ID, 500 kbit/s)
-    //"AT AL",     // Allow Long (>7 byte) messages
-    //"AT AR",     // Automatically receive
-    //"AT H1",     // Headers on (debug only)
-    //"AT D1",     // Display of the DLC on
-    //"AT CAF0",   // Automatic formatting off
-    "AT DP",
-    "AT ST16",
-
-    // Loop from (HYUNDAI IONIQ)
-    // BMS
-    "ATSH7E4",
-    "2101",   // power kw, ...
-    "2102",   // cell voltages, screen 3 only
-    "2103",   // cell voltages, screen 3 only
-    "2104",   // cell voltages, screen 3 only
-    "2105",   // soh, soc, ..
-    "2106",   // cooling water temp
-
-    // VMCU
-    "ATSH7E2",
-    "2101",     // speed, ...
-    "2102",     // aux, ...
-
-    //"ATSH7Df",
-    //"2106",
-    //"220106",
-
-    // Aircondition
-    // IONIQ OK
-    "ATSH7B3",
-    "220100",   // in/out temp
-    "220102",   // coolant temp1, 2
-
-    // BCM / TPMS
-    // IONIQ OK
-    "ATSH7A0",
-    "22c00b",   // tire pressure/temp
-
-    // CLUSTER MODULE
-    // IONIQ OK
-    "ATSH7C6",
-    "22B002",   // odo
-  };
-
   // 28kWh version
   this->liveData->params.batteryTotalAvailableKWh = 28;
   this->liveData->params.batModuleTempCount = 12;
 
-  //  Empty and fill command queue
-  for (int i = 0; i < 300; i++) {
-    this->liveData->commandQueue[i] = "";
-  }
-  for (int i = 0; i < commandQueueCountHyundaiIoniq; i++) {
-    this->liveData->commandQueue[i] = commandQueueHyundaiIoniq[i];
-  }
-
-  this->liveData->commandQueueLoopFrom = commandQueueLoopFromHyundaiIoniq;
-  this->liveData->commandQueueCount = commandQueueCountHyundaiIoniq;
+  // Command queue (indexes into flash table)
+  this->liveData->setCommandQueue(commandQueueHyundaiIoniq, commandQueueCountHyundaiIoniq, commandQueueLoopFromHyundaiIoniq);
+  this->liveData->applyCommandSchedule(commandScheduleHyundaiIoniq, commandScheduleCountHyundaiIoniq);
+  this->setSignals(signalsHyundaiIoniq, signalsCountHyundaiIoniq);
+  this->liveData->setMonitorIds(monitorIdsHyundaiIoniq, monitorIdsCountHyundaiIoniq);
 }
 
 /**
@@ -83,72 +157,41 @@ void CarHyundaiIoniq::activateCommandQueue() {
 */
 void CarHyundaiIoniq::parseRowMerged() {
 
-  // VMCU 7E2
-  if (this->liveData->currentAtshRequest.equals("ATSH7E2")) {
-    if (this->liveData->commandRequest.equals("2101")) {
-      this->liveData->params.speedKmh = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(32, 36).c_str(), 2, false) * 0.0155; // / 100.0 *1.609 = real to gps is 1.750
-      if (this->liveData->params.speedKmh < -99 || this->liveData->params.speedKmh > 200)
-        this->liveData->params.speedKmh = 0;
-    }
-    if (this->liveData->commandRequest.equals("2102")) {
-      this->liveData->params.auxPerc = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(50, 52).c_str(), 1, false);
-      this->liveData->params.auxCurrentAmp = - this->liveData->hexToDec(this->liveData->responseRowMerged.substring(46, 50).c_str(), 2, true) / 1000.0;
-    }
-  }
-
-  // Cluster module 7c6
-  if (this->liveData->currentAtshRequest.equals("ATSH7C6")) {
-    if (this->liveData->commandRequest.equals("22B002")) {
-      this->liveData->params.odoKm = float(strtol(this->liveData->responseRowMerged.substring(18, 24).c_str(), 0, 16));
+  float socPercPrevious = this->liveData->params.socPerc;
+
+  // Plain values by signal table, skip negative responses
+  if (!this->decodeSignals())
+    return;
+
+  // Derived values
+  switch (this->liveData->commandKey) {
+    // ESC broadcast 386, 4 wheel speeds 14 bit little endian (FL, FR, RL, RR), 0.03125 km/h
+    case MONITOR_KEY(0x386): {
+      float wheelsKmh = 0;
+      for (uint8_t i = 0; i < 8; i += 2)
+        wheelsKmh += (this->u8(i) | ((this->u8(i + 1) & 0x3F) << 8)) * 0.03125;
+      this->liveData->params.speedKmh = wheelsKmh / 4;
+      break;
     }
-  }
 
-  // Aircon 7b3
-  if (this->liveData->currentAtshRequest.equals("ATSH7B3")) {
-    if (this->liveData->commandRequest.equals("220100")) {
-      this->liveData->params.indoorTemperature = (this->liveData->hexToDec(this->liveData->responseRowMerged.substring(16, 18).c_str(), 1, false) / 2) - 40;
-      this->liveData->params.outdoorTemperature = (this->liveData->hexToDec(this->liveData->responseRowMerged.substring(18, 20).c_str(), 1, false) / 2) - 40;
-    }
-    if (this->liveData->commandRequest.equals("220102") && this->liveData->responseRowMerged.substring(12, 14) == "00") {
-      this->liveData->params.coolantTemp1C = (this->liveData->hexToDec(this->liveData->responseRowMerged.substring(14, 16).c_str(), 1, false) / 2) - 40;
-      this->liveData->params.coolantTemp2C = (this->liveData->hexToDec(this->liveData->responseRowMerged.substring(16, 18).c_str(), 1, false) / 2) - 40;
+    // VMCU 7E2
+    case COMMAND_KEY(0x7E2, 0x2101): {
+      if (this->liveData->params.speedKmh < -99 || this->liveData->params.speedKmh > 200)
+        this->liveData->params.speedKmh = 0;
+      break;
     }
-  }
 
-  // BMS 7e4
-  if (this->liveData->currentAtshRequest.equals("ATSH7E4")) {
-    if (this->liveData->commandRequest.equals("2101")) {
-      this->liveData->params.cumulativeEnergyChargedKWh = float(strtol(this->liveData->responseRowMerged.substring(80, 88).c_str(), 0, 16)) / 10.0;
+    // BMS 7e4
+    case COMMAND_KEY(0x7E4, 0x2101): {
       if (this->liveData->params.cumulativeEnergyChargedKWhStart == -1)
         this->liveData->params.cumulativeEnergyChargedKWhStart = this->liveData->params.cumulativeEnergyChargedKWh;
-      this->liveData->params.cumulativeEnergyDischargedKWh = float(strtol(this->liveData->responseRowMerged.substring(88, 96).c_str(), 0, 16)) / 10.0;
       if (this->liveData->params.cumulativeEnergyDischargedKWhStart == -1)
         this->liveData->params.cumulativeEnergyDischargedKWhStart = this->liveData->params.cumulativeEnergyDischargedKWh;
-      this->liveData->params.availableChargePower = float(strtol(this->liveData->responseRowMerged.substring(16, 20).c_str(), 0, 16)) / 100.0;
-      this->liveData->params.availableDischargePower = float(strtol(this->liveData->responseRowMerged.substring(20, 24).c_str(), 0, 16)) / 100.0;
-      this->liveData->params.isolationResistanceKOhm = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(118, 122).c_str(), 2, true);
-      this->liveData->params.batFanStatus = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(58, 60).c_str(), 2, true);
-      this->liveData->params.batFanFeedbackHz = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(60, 62).c_str(), 2, true);
-      this->liveData->params.auxVoltage = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(62, 64).c_str(), 2, true) / 10.0;
-      this->liveData->params.batPowerAmp = - this->liveData->hexToDec(this->liveData->responseRowMerged.substring(24, 28).c_str(), 2, true) / 10.0;
-      this->liveData->params.batVoltage = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(28, 32).c_str(), 2, false) / 10.0;
       this->liveData->params.batPowerKw = (this->liveData->params.batPowerAmp * this->liveData->params.batVoltage) / 1000.0;
       if (this->liveData->params.batPowerKw < 1) // Reset charging start time
         this->liveData->params.chargingStartTime = this->liveData->params.currentTime;
       this->liveData->params.batPowerKwh100 = this->liveData->params.batPowerKw / this->liveData->params.speedKmh * 100;
-      this->liveData->params.batCellMaxV = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(50, 52).c_str(), 1, false) / 50.0;
-      this->liveData->params.batCellMinV = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(54, 56).c_str(), 1, false) / 50.0;
-      this->liveData->params.batModuleTempC[0] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(36, 38).c_str(), 1, true);
-      this->liveData->params.batModuleTempC[1] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(38, 40).c_str(), 1, true);
-      this->liveData->params.batModuleTempC[2] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(40, 42).c_str(), 1, true);
-      this->liveData->params.batModuleTempC[3] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(42, 44).c_str(), 1, true);
-      this->liveData->params.batModuleTempC[4] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(44, 46).c_str(), 1, true);
-      //this->liveData->params.batTempC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(34, 36).c_str(), 1, true);
-      //this->liveData->params.batMaxC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(32, 34).c_str(), 1, true);
-      //this->liveData->params.batMinC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(34, 36).c_str(), 1, true);
 
-      // This is more accurate than min/max from BMS. It's required to detect kona/eniro cold gates (min 15C is needed > 43kW charging, min 25C is needed > 58kW charging)
-      this->liveData->params.batInletC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(48, 50).c_str(), 1, true);
       if (this->liveData->params.speedKmh < 10 && this->liveData->params.batPowerKw >= 1 && this->liveData->params.socPerc > 0 && this->liveData->params.socPerc <= 100) {
         if ( this->liveData->params.chargingGraphMinKw[int(this->liveData->params.socPerc)] == -100 || this->liveData->params.batPowerKw < this->liveData->params.chargingGraphMinKw[int(this->liveData->params.socPerc)])
           this->liveData->params.chargingGraphMinKw[int(this->liveData->params.socPerc)] = this->liveData->params.batPowerKw;
@@ -158,40 +201,12 @@ void CarHyundaiIoniq::parseRowMerged() {
         this->liveData->params.chargingGraphBatMaxTempC[int(this->liveData->params.socPerc)] = this->liveData->params.batMaxC;
         this->liveData->params.chargingGraphHeaterTempC[int(this->liveData->params.socPerc)] = this->liveData->params.batHeaterC;
       }
+      break;
     }
-    // BMS 7e4
-    if (this->liveData->commandRequest.equals("2102") && this->liveData->responseRowMerged.substring(10, 12) == "FF") {
-      for (int i = 0; i < 32; i++) {
-        this->liveData->params.cellVoltage[i] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(12 + (i * 2), 12 + (i * 2) + 2).c_str(), 1, false) / 50;
-      }
-    }
-    // BMS 7e4
-    if (this->liveData->commandRequest.equals("2103")) {
-      for (int i = 0; i < 32; i++) {
-        this->liveData->params.cellVoltage[32 + i] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(12 + (i * 2), 12 + (i * 2) + 2).c_str(), 1, false) / 50;
-      }
-    }
-    // BMS 7e4
-    if (this->liveData->commandRequest.equals("2104")) {
-      for (int i = 0; i < 32; i++) {
-        this->liveData->params.cellVoltage[64 + i] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(12 + (i * 2), 12 + (i * 2) + 2).c_str(), 1, false) / 50;
-      }
-    }
-    // BMS 7e4
-    if (this->liveData->commandRequest.equals("2105")) {
-      this->liveData->params.socPercPrevious = this->liveData->params.socPerc;
-      this->liveData->params.sohPerc = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(54, 58).c_str(), 2, false) / 10.0;
-      this->liveData->params.socPerc = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(66, 68).c_str(), 1, false) / 2.0;
-
-      // Remaining battery modules (tempC)
-      this->liveData->params.batModuleTempC[5] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(22, 24).c_str(), 1, true);
-      this->liveData->params.batModuleTempC[6] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(24, 26).c_str(), 1, true);
-      this->liveData->params.batModuleTempC[7] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(26, 28).c_str(), 1, true);
-      this->liveData->params.batModuleTempC[8] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(28, 30).c_str(), 1, true);
-      this->liveData->params.batModuleTempC[9] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(30, 32).c_str(), 1, true);
-      this->liveData->params.batModuleTempC[10] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(32, 34).c_str(), 1, true);
-      this->liveData->params.batModuleTempC[11] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(34, 36).c_str(), 1, true);
+    case COMMAND_KEY(0x7E4, 0x2105): {
+      this->liveData->params.socPercPrevious = socPercPrevious;
 
+      // This is more accurate than min/max from BMS. It's required to detect kona/eniro cold gates (min 15C is needed > 43kW charging, min 25C is needed > 58kW charging)
       this->liveData->params.batMinC = this->liveData->params.batMaxC = this->liveData->params.batModuleTempC[0];
       for (uint16_t i = 1; i < this->liveData->params.batModuleTempCount; i++) {
         if (this->liveData->params.batModuleTempC[i] < this->liveData->params.batMinC)
@@ -211,33 +226,13 @@ void CarHyundaiIoniq::parseRowMerged() {
           this->liveData->params.soc10time[index] = this->liveData->params.currentTime;
         }
       }
-      this->liveData->params.batHeaterC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(50, 52).c_str(), 1, true);
       //
       for (int i = 30; i < 32; i++) { // ai/aj position
         this->liveData->params.cellVoltage[96 - 30 + i] = -1;
       }
-    }
-    // BMS 7e4
-    // IONIQ FAILED
-    if (this->liveData->commandRequest.equals("2106")) {
-      this->liveData->params.coolingWaterTempC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(14, 16).c_str(), 1, false);
-    }
-  }
-
-  // TPMS 7a0
-  if (this->liveData->currentAtshRequest.equals("ATSH7A0")) {
-    if (this->liveData->commandRequest.equals("22c00b")) {
-      this->liveData->params.tireFrontLeftPressureBar = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(14, 16).c_str(), 2, false) / 72.51886900361;     // === OK Valid *0.2 / 14.503773800722
-      this->liveData->params.tireFrontRightPressureBar = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(22, 24).c_str(), 2, false) / 72.51886900361;     // === OK Valid *0.2 / 14.503773800722
-      this->liveData->params.tireRearRightPressureBar = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(30, 32).c_str(), 2, false) / 72.51886900361;    // === OK Valid *0.2 / 14.503773800722
-      this->liveData->params.tireRearLeftPressureBar = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(38, 40).c_str(), 2, false) / 72.51886900361;     // === OK Valid *0.2 / 14.503773800722
-      this->liveData->params.tireFrontLeftTempC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(16, 18).c_str(), 2, false)  - 50;      // === OK Valid
-      this->liveData->params.tireFrontRightTempC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(24, 26).c_str(), 2, false) - 50;      // === OK Valid
-      this->liveData->params.tireRearRightTempC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(32, 34).c_str(), 2, false) - 50;     // === OK Valid
-      this->liveData->params.tireRearLeftTempC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(40, 42).c_str(), 2, false) - 50;     // === OK Valid
+      break;
     }
   }
-
 }
 
 /**
@@ -249,12 +244,12 @@ void CarHyundaiIoniq::loadTestData() {
   this->liveData->currentAtshRequest = "ATSH7E2";
   // 2101
   this->liveData->commandRequest = "2101";
-  this->liveData->responseRowMerged = "6101FFE0000009211222062F03000000001D7734";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("6101FFE0000009211222062F03000000001D7734");
+  this->parseTestResponse();
   // 2102
   this->liveData->commandRequest = "2102";
-  this->liveData->responseRowMerged = "6102FF80000001010000009315B2888D390B08618B683900000000";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("6102FF80000001010000009315B2888D390B08618B683900000000");
+  this->parseTestResponse();
 
   // "ATSH7DF",
   this->liveData->currentAtshRequest = "ATSH7DF";
@@ -263,61 +258,61 @@ void CarHyundaiIoniq::loadTestData() {
   this->liveData->currentAtshRequest = "ATSH7B3";
   // 220100
   this->liveData->commandRequest = "220100";
-  this->liveData->responseRowMerged = "6201007E5007C8FF8A876A011010FFFF10FF10FFFFFFFFFFFFFFFFFF2EEF767D00FFFF00FFFF000000";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("6201007E5007C8FF8A876A011010FFFF10FF10FFFFFFFFFFFFFFFFFF2EEF767D00FFFF00FFFF000000");
+  this->parseTestResponse();
   // 220102
   this->liveData->commandRequest = "220102";
-  this->liveData->responseRowMerged = "620102FF800000A3950000000000002600000000";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("620102FF800000A3950000000000002600000000");
+  this->parseTestResponse();
 
   // BMS ATSH7E4
   this->liveData->currentAtshRequest = "ATSH7E4";
   // 220101
   this->liveData->commandRequest = "2101";
-  this->liveData->responseRowMerged = "6101FFFFFFFF5026482648A3FFC30D9E181717171718170019B50FB501000090000142230001425F0000771B00007486007815D809015C0000000003E800";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("6101FFFFFFFF5026482648A3FFC30D9E181717171718170019B50FB501000090000142230001425F0000771B00007486007815D809015C0000000003E800");
+  this->parseTestResponse();
   // 220102
   this->liveData->commandRequest = "2102";
-  this->liveData->responseRowMerged = "6102FFFFFFFFB5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5000000";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("6102FFFFFFFFB5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5000000");
+  this->parseTestResponse();
   // 220103
   this->liveData->commandRequest = "2103";
-  this->liveData->responseRowMerged = "6103FFFFFFFFB5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5000000";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("6103FFFFFFFFB5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5000000");
+  this->parseTestResponse();
   // 220104
   this->liveData->commandRequest = "2104";
-  this->liveData->responseRowMerged = "6104FFFFFFFFB5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5000000";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("6104FFFFFFFFB5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5B5000000");
+  this->parseTestResponse();
   // 220105
   this->liveData->commandRequest = "2105";
-  this->liveData->responseRowMerged = "6105FFFFFFFF00000000001717171817171726482648000150181703E81A03E801520029000000000000000000000000";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("6105FFFFFFFF00000000001717171817171726482648000150181703E81A03E801520029000000000000000000000000");
+  this->parseTestResponse();
   // 220106
   this->liveData->commandRequest = "2106";
-  this->liveData->responseRowMerged = "7F2112"; // n/a on ioniq
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("7F2112"); // n/a on ioniq
+  this->parseTestResponse();
 
   // BCM / TPMS ATSH7A0
   this->liveData->currentAtshRequest = "ATSH7A0";
   // 22c00b
   this->liveData->commandRequest = "22c00b";
-  this->liveData->responseRowMerged = "62C00BFFFF0000B9510100B9510100B84F0100B54F0100AAAAAAAA";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("62C00BFFFF0000B9510100B9510100B84F0100B54F0100AAAAAAAA");
+  this->parseTestResponse();
 
   // ATSH7C6
   this->liveData->currentAtshRequest = "ATSH7C6";
   // 22b002
   this->liveData->commandRequest = "22b002";
-  this->liveData->responseRowMerged = "62B002E000000000AD003D2D0000000000000000";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("62B002E000000000AD003D2D0000000000000000");
+  this->parseTestResponse();
 
   /*  this->liveData->params.batModule01TempC = 28;
     this->liveData->params.batModule02TempC = 29;
     this->liveData->params.batModule03TempC = 28;
     this->liveData->params.batModule04TempC = 30;
-    //this->liveData->params.batTempC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(36, 38).c_str(), 1, true);
-    //this->liveData->params.batMaxC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(34, 36).c_str(), 1, true);
-    //this->liveData->params.batMinC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(36, 38).c_str(), 1, true);
+    //this->liveData->params.batTempC = this->s8(18);
+    //this->liveData->params.batMaxC = this->s8(17);
+    //this->liveData->params.batMinC = this->s8(18);
 
     // This is more accurate than min/max from BMS. It's required to detect kona/eniro cold gates (min 15C is needed > 43kW charging, min 25C is needed > 58kW charging)
     this->liveData->params.batMinC = this->liveData->params.batMaxC = this->liveData->params.batModule01TempC;
@@ -20,4 +20,231 @@ void CarInterface::loadTestData() {
   
 }
 
+/**
+  Decode merged response to binary payload (once) and parse it by car
+*/
+void CarInterface::parseMergedResponse() {
+
+  this->updateTime();
+  this->liveData->decodeResponse();
+  this->cellsFrom = this->cellsCount = 0;
+  this->parseRowMerged();
+  if (this->cellsCount != 0)
+    this->liveData->updateCellStats(this->cellsFrom, this->cellsCount);
+}
+
+/**
+  Clock of main loop to params, charging time starts with first response
+*/
+void CarInterface::updateTime() {
+
+  this->liveData->params.currentTime = __atomic_load_n(&this->liveData->clockTime, __ATOMIC_RELAXED);
+  if (this->liveData->params.chargingStartTime == 0)
+    this->liveData->params.chargingStartTime = this->liveData->params.currentTime;
+}
+
+/**
+  Parse test response (main loop, no parser task), key is computed from request strings
+*/
+void CarInterface::parseTestResponse() {
+
+  strlcpy(this->liveData->responseRequest, this->liveData->commandRequest.c_str(), COMMAND_REQUEST_SIZE);
+  this->liveData->commandKey = this->liveData->makeCommandKey(this->liveData->currentAtshRequest.c_str(), this->liveData->responseRequest);
+  this->parseMergedResponse();
+}
+
+/**
+  Hash slot of key (open addressing, linear probing)
+  Returns SIGNAL_INDEX_SIZE if key is not indexed and all slots are used
+*/
+uint16_t CarInterface::signalSlot(uint64_t key) {
+
+  uint16_t slot = (uint16_t)(((uint32_t)(key >> 32) * 31 + (uint32_t)key) * 2654435761u >> 26) & (SIGNAL_INDEX_SIZE - 1);
+
+  for (uint16_t probes = 0; probes < SIGNAL_INDEX_SIZE; probes++) {
+    if (this->signalIndex[slot].key == 0 || this->signalIndex[slot].key == key)
+      return slot;
+    slot = (slot + 1) & (SIGNAL_INDEX_SIZE - 1);
+  }
+
+  return SIGNAL_INDEX_SIZE;
+}
+
+/**
+  Set signal table of car and build index key -> rows (rows of one command must be consecutive)
+  Returns false if table has more commands than SIGNAL_INDEX_SIZE (rows of other commands are not decoded)
+*/
+bool CarInterface::setSignals(const SIGNAL_DEF* pSignals, uint16_t pSignalsCount) {
+
+  bool indexed = true;
+
+  this->signals = pSignals;
+  this->signalsCount = pSignalsCount;
+  for (uint16_t i = 0; i < SIGNAL_INDEX_SIZE; i++) {
+    this->signalIndex[i].key = 0;
+    this->signalIndex[i].first = this->signalIndex[i].count = 0;
+  }
+
+  for (uint16_t i = 0; i < pSignalsCount; i++) {
+    uint16_t slot = this->signalSlot(pSignals[i].key);
+    if (slot == SIGNAL_INDEX_SIZE) {
+      if (indexed)
+        Serial.println("Signal index full, increase SIGNAL_INDEX_SIZE");
+      indexed = false;
+      continue;
+    }
+    if (this->signalIndex[slot].key == 0) {
+      this->signalIndex[slot].key = pSignals[i].key;
+      this->signalIndex[slot].first = i;
+    }
+    this->signalIndex[slot].count++;
+  }
+
+  return indexed;
+}
+
+/**
+  Set suggested charging curves of car, battery voltage is linear between 0 and 100% SOC
+*/
+void CarInterface::setChargingCurves(const CHARGING_CURVE_LINE* pCurves, uint8_t pCurvesCount, uint16_t voltageSoc0, uint16_t voltageSoc100) {
+
+  this->chargingCurves = pCurves;
+  this->chargingCurvesCount = pCurvesCount;
+  this->chargingVoltageSoc0 = voltageSoc0;
+  this->chargingVoltageSoc100 = voltageSoc100;
+}
+
+/**
+  Charging power (kW) of curve point
+*/
+uint16_t CarInterface::chargingCurveKw(uint8_t soc, uint8_t amps) {
+
+  return (uint32_t)amps * (soc * (this->chargingVoltageSoc100 - this->chargingVoltageSoc0) / 100 + this->chargingVoltageSoc0) / 1000;
+}
+
+/**
+  Decode values of current response by signal table
+  Returns false for negative / unexpected response
+*/
+bool CarInterface::decodeSignals() {
+
+  uint16_t length = this->liveData->responsePayloadLength;
+  const char* request = this->liveData->responseRequest;
+  uint16_t requestLength = strlen(request) / 2;
+
+  // Broadcast frame (monitor mode) has no request, rows of arbitration id only
+  if ((uint32_t)this->liveData->commandKey == 0 && (this->liveData->commandKey >> 32) != 0) {
+    if (length == 0)
+      return false;
+    this->decodeSignalRows();
+    return true;
+  }
+
+  // Positive response is 0x40 + service (22 -> 62)
+  if (length == 0 || requestLength == 0 || length < requestLength ||
+      this->u8(0) != (uint8_t)(0x40 + this->liveData->hexToByte(request)))
+    return false;
+  // Followed by requested DID, late response of skipped command is dropped (62 0101 for 22 0105)
+  for (uint16_t i = 1; i < requestLength; i++) {
+    if (this->u8(i) != this->liveData->hexToByte(request + i * 2)) {
+      this->liveData->responseMismatches++;
+      return false;
+    }
+  }
+  this->decodeSignalRows();
+
+  return true;
+}
+
+/**
+  Decode signal rows of commandKey from payload
+*/
+void CarInterface::decodeSignalRows() {
+
+  uint16_t length = this->liveData->responsePayloadLength;
+
+  if (this->signals == NULL || this->liveData->commandKey == 0)
+    return;
+
+  uint16_t slot = this->signalSlot(this->liveData->commandKey);
+  if (slot == SIGNAL_INDEX_SIZE)
+    return;
+  SIGNAL_INDEX* index = &this->signalIndex[slot];
+  for (uint16_t i = index->first; i < index->first + index->count; i++) {
+    const SIGNAL_DEF* signal = &this->signals[i];
+    if (signal->matchByte != SIGNAL_MATCH_ANY && (signal->matchByte >= length || this->u8(signal->matchByte) != signal->matchValue))
+      continue;
+    if (signal->offset + signal->bytes * signal->count > length)
+      continue;
+
+    float* dest = (float*)((uint8_t*)&this->liveData->params + signal->dest);
+    for (uint8_t j = 0; j < signal->count; j++) {
+      uint16_t offset = signal->offset + j * signal->bytes;
+      float raw;
+      switch (signal->bytes) {
+        case 1: raw = signal->signedNum ? (float)this->s8(offset) : (float)this->u8(offset); break;
+        case 2: raw = signal->signedNum ? (float)this->s16be(offset) : (float)this->u16be(offset); break;
+        case 3: raw = (float)this->u24be(offset); break;
+        default: raw = signal->signedNum ? (float)(int32_t)this->u32be(offset) : (float)this->u32be(offset);
+      }
+      dest[j] = raw * signal->scale + signal->valueOffset;
+    }
+
+    // Cell voltages changed
+    if (signal->dest >= PARAM(cellVoltage) && signal->dest < PARAM(cellVoltage) + sizeof(this->liveData->params.cellVoltage)) {
+      uint16_t from = (signal->dest - PARAM(cellVoltage)) / sizeof(float);
+      uint16_t to = from + signal->count;
+      if (this->cellsCount != 0) {
+        if (this->cellsFrom + this->cellsCount > to)
+          to = this->cellsFrom + this->cellsCount;
+        if (this->cellsFrom < from)
+          from = this->cellsFrom;
+      }
+      this->cellsFrom = from;
+      this->cellsCount = to - from;
+    }
+  }
+}
+
+/**
+  Decode broadcast frame (monitor mode) by signal rows and car, frame data bytes are in responseRowMerged
+*/
+void CarInterface::parseMonitorFrame(uint16_t id) {
+
+  this->updateTime();
+  this->liveData->decodeResponse();
+  this->liveData->commandKey = MONITOR_KEY(id);
+  this->cellsFrom = this->cellsCount = 0;
+  this->parseRowMerged();
+  if (this->cellsCount != 0)
+    this->liveData->updateCellStats(this->cellsFrom, this->cellsCount);
+}
+
+/**
+  Payload accessors
+*/
+uint8_t CarInterface::u8(uint16_t offset) {
+  return (offset < this->liveData->responsePayloadLength) ? this->liveData->responsePayload[offset] : 0;
+}
+
+int8_t CarInterface::s8(uint16_t offset) {
+  return (int8_t)this->u8(offset);
+}
+
+uint16_t CarInterface::u16be(uint16_t offset) {
+  return ((uint16_t)this->u8(offset) << 8) | this->u8(offset + 1);
+}
+
+int16_t CarInterface::s16be(uint16_t offset) {
+  return (int16_t)this->u16be(offset);
+}
+
+uint32_t CarInterface::u24be(uint16_t offset) {
+  return ((uint32_t)this->u16be(offset) << 8) | this->u8(offset + 2);
+}
+
+uint32_t CarInterface::u32be(uint16_t offset) {
+  return ((uint32_t)this->u16be(offset) << 16) | this->u16be(offset + 2);
+}
+
 #endif // CARINTERFACE_CPP
@@ -1,17 +1,81 @@
 #ifndef CARINTERFACE_H
 #define CARINTERFACE_H
 
+#include <stddef.h>
 #include "LiveData.h"
 
+// Destination of decoded value (float field of PARAMS_STRUC)
+#define PARAM(field) offsetof(PARAMS_STRUC, field)
+#define SIGNAL_MATCH_ANY -1
+#define SIGNAL_INDEX_SIZE 64 // hash slots (power of 2, more than commands with signals)
+
+// Value decoded from response payload, dest = raw * scale + valueOffset
+typedef struct {
+  uint64_t key;         // COMMAND_KEY(header, command)
+  uint16_t dest;        // PARAM(field)
+  uint16_t offset;      // byte offset in payload
+  uint8_t bytes;        // 1..4, big endian
+  bool signedNum;
+  float scale;
+  float valueOffset;
+  uint8_t count;        // consecutive values (cell voltages, module temps)
+  int16_t matchByte;    // decode only if payload[matchByte] == matchValue (SIGNAL_MATCH_ANY)
+  uint8_t matchValue;
+} SIGNAL_DEF;
+
+// Line of suggested charging curve, kW = amps * voltage(SOC) / 1000
+typedef struct {
+  uint8_t socFrom;
+  uint8_t ampsFrom;
+  uint8_t socTo;
+  uint8_t ampsTo;
+  uint16_t color;
+} CHARGING_CURVE_LINE;
+
+// Rows of one command in signal table
+typedef struct {
+  uint64_t key;         // 0 - empty slot
+  uint16_t first;
+  uint16_t count;
+} SIGNAL_INDEX;
+
 class CarInterface {
   
   private:
+    const SIGNAL_DEF* signals = NULL;
+    uint16_t signalsCount = 0;
+    SIGNAL_INDEX signalIndex[SIGNAL_INDEX_SIZE];
+    uint16_t signalSlot(uint64_t key);
+    // Cells decoded from current response (cell statistics)
+    uint16_t cellsFrom;
+    uint16_t cellsCount;
   public:
     LiveData* liveData;   
+    // Suggested charging curves (NULL - not available for car)
+    const CHARGING_CURVE_LINE* chargingCurves = NULL;
+    uint8_t chargingCurvesCount = 0;
+    uint16_t chargingVoltageSoc0 = 0;
+    uint16_t chargingVoltageSoc100 = 0;
     void setLiveData(LiveData* pLiveData); 
     virtual void activateCommandQueue();
     virtual void parseRowMerged();
     virtual void loadTestData();  
+    void updateTime();
+    void parseMergedResponse();
+    void parseTestResponse();
+    bool setSignals(const SIGNAL_DEF* pSignals, uint16_t pSignalsCount);
+    void setChargingCurves(const CHARGING_CURVE_LINE* pCurves, uint8_t pCurvesCount, uint16_t voltageSoc0, uint16_t voltageSoc100);
+    uint16_t chargingCurveKw(uint8_t soc, uint8_t amps);
+    bool decodeSignals();
+    void decodeSignalRows();
+    void parseMonitorFrame(uint16_t id);
+    // Decoded response payload, big endian values at byte offset (0 beyond response length)
+    uint8_t u8(uint16_t offset);
+    int8_t s8(uint16_t offset);
+    uint16_t u16be(uint16_t offset);
+    int16_t s16be(uint16_t offset);
+    uint32_t u24be(uint16_t offset);
+    uint32_t u32be(uint16_t offset);
 };
 
 #endif // CARINTERFACE_H
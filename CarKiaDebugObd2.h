@@ -1,16 +1,14 @@
 #ifndef CARKIADEBUGOBD2_H
 #define CARKIADEBUGOBD2_H
 
-#include "CarInterface.h"
+#include "CarKiaEniro.h"
 
-class CarKiaDebugObd2 : public CarInterface {
+class CarKiaDebugObd2 : public CarKiaEniro {
   
   private:
     
   public:
-    void activateCommandQueue() override;
-    void parseRowMerged() override;
-    void loadTestData() override;  
+    void activateCommandQueue() override; // responses are parsed by CarKiaEniro
 };
 
 #endif // CARKIADEBUGOBD2_H
@@ -19,69 +19,193 @@
 #include "LiveData.h"
 #include "CarKiaEniro.h"
 
-#define commandQueueCountKiaENiro 30
+#define commandQueueCountKiaENiro (sizeof(commandQueueKiaENiro) / sizeof(commandQueueKiaENiro[0]))
 #define commandQueueLoopFromKiaENiro 10
+#define commandScheduleCountKiaENiro 15
+#define signalsCountKiaENiro 42
+#define chargingCurvesCountKiaENiro 27
 
 /**
- * activateCommandQueue
+ * Refresh rates (ms) and provided signals, power/speed/brake lights are requested every loop
  */
-void CarKiaEniro::activateCommandQueue() {
+const COMMAND_SCHEDULE commandScheduleKiaENiro[commandScheduleCountKiaENiro] = {
+  {"ATSH7D1", "22C101", 1000, SIGNAL_DRIVE_MODE},
+  {"ATSH770", "22BC03", 2000, SIGNAL_LIGHTS},     // ignition, lights
+  {"ATSH770", "22BC06", 0, SIGNAL_BRAKE_LIGHTS},
+  {"ATSH7E2", "2101", 0, SIGNAL_SPEED},
+  {"ATSH7E2", "2102", 5000, SIGNAL_AUX},
+  {"ATSH7E4", "220101", 0, SIGNAL_BATTERY},       // power
+  {"ATSH7E4", "220102", 10000, SIGNAL_CELLS},
+  {"ATSH7E4", "220103", 10000, SIGNAL_CELLS},
+  {"ATSH7E4", "220104", 10000, SIGNAL_CELLS},
+  {"ATSH7E4", "220105", 5000, SIGNAL_SOC | SIGNAL_CELLS}, // soc, soh, heater, cells 97-98
+  {"ATSH7E4", "220106", 10000, SIGNAL_COOLANT},
+  {"ATSH7B3", "220100", 10000, SIGNAL_AIRCON},    // in/out temp
+  {"ATSH7B3", "220102", 10000, SIGNAL_AIRCON},    // coolant temp
+  {"ATSH7A0", "22c00b", 30000, SIGNAL_TIRES},
+  {"ATSH7C6", "22B002", 10000, SIGNAL_ODO},
+};
 
-  String commandQueueKiaENiro[commandQueueCountKiaENiro] = {
-    "AT Z",      // Reset all
-    "AT I",      // Print the version ID
-    "AT S0",     // Printing of spaces on
-    "AT E0",     // Echo off
-    "AT L0",     // Linefeeds off
-    "AT SP 6",   // Select protocol to ISO 15765-4 CAN (11 bit ID, 500 kbit/s)
-    //"AT AL",     // Allow Long (>7 byte) messages
-    //"AT AR",     // Automatically receive
-    //"AT H1",     // Headers on (debug only)
-    //"AT D1",     // Display of the DLC on
-    //"AT CAF0",   // Automatic formatting off
-    ////"AT AT0",     // disabled adaptive timing
-    "AT DP",
-    "AT ST16",    // reduced timeout to 1, orig.16
-
-    // Loop from (KIA ENIRO)
-
-    // ABS / ESP + AHB
-    "ATSH7D1",
-    "22C101",     // brake, park/drive mode
+/**
+ * Plain values (raw * scale + offset), derived values are computed in parseRowMerged
+ * Pressure bar = raw * 0.2 / 14.503773800722
+ */
+const SIGNAL_DEF signalsKiaENiro[signalsCountKiaENiro] = {
+  // VMCU 7E2
+  {COMMAND_KEY(0x7E2, 0x2101), PARAM(speedKmh), 16, 2, false, 0.0155, 0, 1, SIGNAL_MATCH_ANY, 0}, // / 100.0 *1.609 = real to gps is 1.750
+  {COMMAND_KEY(0x7E2, 0x2102), PARAM(auxPerc), 25, 1, false, 1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E2, 0x2102), PARAM(auxCurrentAmp), 23, 2, true, -0.001, 0, 1, SIGNAL_MATCH_ANY, 0},
+  // Cluster module 7c6
+  {COMMAND_KEY(0x7C6, 0x22B002), PARAM(odoKm), 9, 3, false, 1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  // Aircon 7b3
+  {COMMAND_KEY(0x7B3, 0x220100), PARAM(indoorTemperature), 8, 1, false, 0.5, -40, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7B3, 0x220100), PARAM(outdoorTemperature), 9, 1, false, 0.5, -40, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7B3, 0x220102), PARAM(coolantTemp1C), 7, 1, false, 0.5, -40, 1, 6, 0x00},
+  {COMMAND_KEY(0x7B3, 0x220102), PARAM(coolantTemp2C), 8, 1, false, 0.5, -40, 1, 6, 0x00},
+  // BMS 7e4
+  {COMMAND_KEY(0x7E4, 0x220101), PARAM(cumulativeEnergyChargedKWh), 41, 4, false, 0.1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220101), PARAM(cumulativeEnergyDischargedKWh), 45, 4, false, 0.1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220101), PARAM(availableChargePower), 8, 2, false, 0.01, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220101), PARAM(availableDischargePower), 10, 2, false, 0.01, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220101), PARAM(batFanStatus), 30, 1, false, 1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220101), PARAM(batFanFeedbackHz), 31, 1, false, 1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220101), PARAM(auxVoltage), 32, 1, false, 0.1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220101), PARAM(batPowerAmp), 13, 2, true, -0.1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220101), PARAM(batVoltage), 15, 2, false, 0.1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220101), PARAM(batCellMaxV), 26, 1, false, 0.02, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220101), PARAM(batCellMinV), 28, 1, false, 0.02, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220101), PARAM(batModuleTempC), 19, 1, true, 1, 0, 4, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220101), PARAM(motorRpm), 56, 2, false, 1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220101), PARAM(batInletC), 25, 1, true, 1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220102), PARAM(cellVoltage[0]), 7, 1, false, 0.02, 0, 32, 6, 0xFF},
+  {COMMAND_KEY(0x7E4, 0x220103), PARAM(cellVoltage[32]), 7, 1, false, 0.02, 0, 32, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220104), PARAM(cellVoltage[64]), 7, 1, false, 0.02, 0, 32, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220105), PARAM(sohPerc), 28, 2, false, 0.1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220105), PARAM(socPerc), 34, 1, false, 0.5, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220105), PARAM(bmsUnknownTempA), 15, 1, true, 1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220105), PARAM(batHeaterC), 26, 1, true, 1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220105), PARAM(bmsUnknownTempB), 41, 1, true, 1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220105), PARAM(cellVoltage[96]), 37, 1, false, 0.02, 0, 2, SIGNAL_MATCH_ANY, 0}, // ai/aj position
+  {COMMAND_KEY(0x7E4, 0x220106), PARAM(coolingWaterTempC), 7, 1, false, 1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220106), PARAM(bmsUnknownTempC), 9, 1, true, 1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7E4, 0x220106), PARAM(bmsUnknownTempD), 23, 1, true, 1, 0, 1, SIGNAL_MATCH_ANY, 0},
+  // TPMS 7a0
+  {COMMAND_KEY(0x7A0, 0x22C00B), PARAM(tireFrontLeftPressureBar), 7, 1, false, 1 / 72.51886900361, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7A0, 0x22C00B), PARAM(tireFrontRightPressureBar), 11, 1, false, 1 / 72.51886900361, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7A0, 0x22C00B), PARAM(tireRearRightPressureBar), 15, 1, false, 1 / 72.51886900361, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7A0, 0x22C00B), PARAM(tireRearLeftPressureBar), 19, 1, false, 1 / 72.51886900361, 0, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7A0, 0x22C00B), PARAM(tireFrontLeftTempC), 8, 1, false, 1, -50, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7A0, 0x22C00B), PARAM(tireFrontRightTempC), 12, 1, false, 1, -50, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7A0, 0x22C00B), PARAM(tireRearRightTempC), 16, 1, false, 1, -50, 1, SIGNAL_MATCH_ANY, 0},
+  {COMMAND_KEY(0x7A0, 0x22C00B), PARAM(tireRearLeftTempC), 20, 1, false, 1, -50, 1, SIGNAL_MATCH_ANY, 0},
+};
+// Each command has at least one row, index of commands fits
+static_assert(signalsCountKiaENiro <= SIGNAL_INDEX_SIZE, "signal rows exceed SIGNAL_INDEX_SIZE");
 
-    // IGPM
-    "ATSH770",
-    "22BC03",     // low beam
-    "22BC06",     // brake light
-
-    // VMCU
-    "ATSH7E2",
-    "2101",     // speed, ...
-    "2102",     // aux, ...
-
-    // BMS
-    "ATSH7E4",
-    "220101",   // power kw, ...
-    "220102",   // cell voltages
-    "220103",   // cell voltages
-    "220104",   // cell voltages
-    "220105",   // soh, soc, ..
-    "220106",   // cooling water temp
-
-    // Aircondition
-    "ATSH7B3",
-    "220100",   // in/out temp
-    "220102",   // coolant temp1, 2
-
-    // BCM / TPMS
-    "ATSH7A0",
-    "22c00b",   // tire pressure/temp
-
-    // CLUSTER MODULE
-    "ATSH7C6",
-    "22B002",   // odo
-
-  };
+/**
+ * Suggested charging curves (SOC, amps), first line of each gate starts at min. SOC
+ */
+const CHARGING_CURVE_LINE chargingCurvesKiaENiro[chargingCurvesCountKiaENiro] = {
+  // Rapid gate
+  {1, 180, 57, 180, TFT_GRAPH_RAPIDGATE35},
+  // Coldgate <5C
+  {1, 60, 65, 60, TFT_GRAPH_COLDGATE0_5},
+  // Coldgate 5-14C
+  {1, 110, 57, 110, TFT_GRAPH_COLDGATE5_14},
+  {57, 110, 58, 75, TFT_GRAPH_COLDGATE5_14},
+  {58, 75, 64, 75, TFT_GRAPH_COLDGATE5_14},
+  {64, 75, 65, 60, TFT_GRAPH_COLDGATE5_14},
+  {65, 60, 82, 60, TFT_GRAPH_COLDGATE5_14},
+  {82, 60, 83, 40, TFT_GRAPH_COLDGATE5_14},
+  // Coldgate 15-24C
+  {1, 150, 57, 150, TFT_GRAPH_COLDGATE15_24},
+  {57, 150, 58, 110, TFT_GRAPH_COLDGATE15_24},
+  {58, 110, 78, 110, TFT_GRAPH_COLDGATE15_24},
+  // Optimal
+  {1, 200, 57, 200, TFT_GRAPH_OPTIMAL25},
+  {51, 200, 51, 195, TFT_GRAPH_OPTIMAL25},
+  {53, 200, 53, 195, TFT_GRAPH_OPTIMAL25},
+  {55, 200, 55, 195, TFT_GRAPH_OPTIMAL25},
+  {57, 200, 58, 150, TFT_GRAPH_OPTIMAL25},
+  {58, 150, 77, 150, TFT_GRAPH_OPTIMAL25},
+  {71, 150, 71, 145, TFT_GRAPH_OPTIMAL25},
+  {73, 150, 73, 145, TFT_GRAPH_OPTIMAL25},
+  {75, 150, 75, 145, TFT_GRAPH_OPTIMAL25},
+  {77, 150, 78, 90, TFT_GRAPH_OPTIMAL25},
+  {78, 90, 82, 90, TFT_GRAPH_OPTIMAL25},
+  {82, 90, 83, 60, TFT_GRAPH_OPTIMAL25},
+  {83, 60, 92, 60, TFT_GRAPH_OPTIMAL25},
+  {92, 60, 95, 35, TFT_GRAPH_OPTIMAL25},
+  {95, 35, 98, 35, TFT_GRAPH_OPTIMAL25},
+  {98, 35, 100, 15, TFT_GRAPH_OPTIMAL25},
+};
+
+// BMS sends long cell voltage responses, tolerates block size 0 / STmin 0
+constexpr const char* flowControlKiaENiro[] = {
+  "ATSH7E4\r",
+};
+#define flowControlCountKiaENiro (sizeof(flowControlKiaENiro) / sizeof(flowControlKiaENiro[0]))
+
+// Commands in flash, terminated by \r (sent as is)
+constexpr const char* commandQueueKiaENiro[] = {
+  "AT Z\r",      // Reset all
+  "AT I\r",      // Print the version ID
+  "AT S0\r",     // Printing of spaces on
+  "AT E0\r",     // Echo off
+  "AT L0\r",     // Linefeeds off
+  "AT SP 6\r",   // Select protocol to ISO 15765-4 CAN (11 bit ID, 500 kbit/s)
+  //"AT AL",     // Allow Long (>7 byte) messages
+  //"AT AR",     // Automatically receive
+  //"AT H1",     // Headers on (debug only)
+  //"AT D1",     // Display of the DLC on
+  //"AT CAF0",   // Automatic formatting off
+  ////"AT AT0",     // disabled adaptive timing
+  "AT DP\r",
+  "AT ST16\r",    // reduced timeout to 1, orig.16
+
+  // Loop from (KIA ENIRO)
+
+  // ABS / ESP + AHB
+  "ATSH7D1\r",
+  "22C101\r",     // brake, park/drive mode
+
+  // IGPM
+  "ATSH770\r",
+  "22BC03\r",     // low beam
+  "22BC06\r",     // brake light
+
+  // VMCU
+  "ATSH7E2\r",
+  "2101\r",     // speed, ...
+  "2102\r",     // aux, ...
+
+  // BMS
+  "ATSH7E4\r",
+  "220101\r",   // power kw, ...
+  "220102\r",   // cell voltages
+  "220103\r",   // cell voltages
+  "220104\r",   // cell voltages
+  "220105\r",   // soh, soc, ..
+  "220106\r",   // cooling water temp
+
+  // Aircondition
+  "ATSH7B3\r",
+  "220100\r",   // in/out temp
+  "220102\r",   // coolant temp1, 2
+
+  // BCM / TPMS
+  "ATSH7A0\r",
+  "22c00b\r",   // tire pressure/temp
+
+  // CLUSTER MODULE
+  "ATSH7C6\r",
+  "22B002\r",   // odo
+};
+
+/**
+ * activateCommandQueue
+ */
+void CarKiaEniro::activateCommandQueue() {
 
   // 39 or 64 kWh model?
   this->liveData->params.batModuleTempCount = 4;
@@ -91,16 +215,13 @@ void CarKiaEniro::activateCommandQueue() {
     this->liveData->params.batteryTotalAvailableKWh = 39.2;
   }
 
-  //  Empty and fill command queue
-  for (int i = 0; i < 300; i++) {
-    this->liveData->commandQueue[i] = "";
-  }
-  for (int i = 0; i < commandQueueCountKiaENiro; i++) {
-    this->liveData->commandQueue[i] = commandQueueKiaENiro[i];
-  }
-
-  this->liveData->commandQueueLoopFrom = commandQueueLoopFromKiaENiro;
-  this->liveData->commandQueueCount = commandQueueCountKiaENiro;
+  // Command queue (indexes into flash table)
+  this->liveData->setCommandQueue(commandQueueKiaENiro, commandQueueCountKiaENiro, commandQueueLoopFromKiaENiro);
+  this->liveData->applyCommandSchedule(commandScheduleKiaENiro, commandScheduleCountKiaENiro);
+  this->setSignals(signalsKiaENiro, signalsCountKiaENiro);
+  this->setChargingCurves(chargingCurvesKiaENiro, chargingCurvesCountKiaENiro, 352, 407);
+  this->liveData->setFlowControlHeaders(flowControlKiaENiro, flowControlCountKiaENiro);
+  this->liveData->setPeriodicDids(NULL, 0); // no verified periodic DIDs (0xF2xx), e.g. {"ATSH7E4\r", 0x7EC, 0x01, COMMAND_KEY(0x7E4, 0x220101)}
 }
 
 /**
@@ -109,99 +230,59 @@ void CarKiaEniro::activateCommandQueue() {
 void CarKiaEniro::parseRowMerged() {
 
   bool tempByte;
+  float socPercPrevious = this->liveData->params.socPerc;
 
-  // ABS / ESP + AHB 7D1
-  if (this->liveData->currentAtshRequest.equals("ATSH7D1")) {
-    if (this->liveData->commandRequest.equals("22C101")) {
-      uint8_t driveMode = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(22, 24).c_str(), 1, false);
+  // Plain values by signal table, skip negative responses
+  if (!this->decodeSignals())
+    return;
+
+  // Derived values
+  switch (this->liveData->commandKey) {
+    // ABS / ESP + AHB 7D1
+    case COMMAND_KEY(0x7D1, 0x22C101): {
+      uint8_t driveMode = this->u8(11);
       this->liveData->params.forwardDriveMode = (driveMode == 4);
       this->liveData->params.reverseDriveMode = (driveMode == 2);
       this->liveData->params.parkModeOrNeutral  = (driveMode == 1);
+      break;
     }
-  }
 
-  // IGPM
-  if (this->liveData->currentAtshRequest.equals("ATSH770")) {
-    if (this->liveData->commandRequest.equals("22BC03")) {
-      tempByte = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(16, 18).c_str(), 1, false);
+    // IGPM
+    case COMMAND_KEY(0x770, 0x22BC03): {
+      tempByte = this->u8(8);
       this->liveData->params.ignitionOnPrevious = this->liveData->params.ignitionOn;
       this->liveData->params.ignitionOn = (bitRead(tempByte, 5) == 1);
       if (this->liveData->params.ignitionOnPrevious && !this->liveData->params.ignitionOn)
         this->liveData->params.automaticShutdownTimer = this->liveData->params.currentTime;
 
-      this->liveData->params.lightInfo = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(18, 20).c_str(), 1, false);
+      this->liveData->params.lightInfo = this->u8(9);
       this->liveData->params.headLights = (bitRead(this->liveData->params.lightInfo, 5) == 1);
       this->liveData->params.dayLights = (bitRead(this->liveData->params.lightInfo, 3) == 1);
+      break;
     }
-    if (this->liveData->commandRequest.equals("22BC06")) {
-      this->liveData->params.brakeLightInfo = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(14, 16).c_str(), 1, false);
+    case COMMAND_KEY(0x770, 0x22BC06): {
+      this->liveData->params.brakeLightInfo = this->u8(7);
       this->liveData->params.brakeLights = (bitRead(this->liveData->params.brakeLightInfo, 5) == 1);
+      break;
     }
-  }
 
-  // VMCU 7E2
-  if (this->liveData->currentAtshRequest.equals("ATSH7E2")) {
-    if (this->liveData->commandRequest.equals("2101")) {
-      this->liveData->params.speedKmh = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(32, 36).c_str(), 2, false) * 0.0155; // / 100.0 *1.609 = real to gps is 1.750
+    // VMCU 7E2
+    case COMMAND_KEY(0x7E2, 0x2101): {
       if (this->liveData->params.speedKmh < -99 || this->liveData->params.speedKmh > 200)
         this->liveData->params.speedKmh = 0;
+      break;
     }
-    if (this->liveData->commandRequest.equals("2102")) {
-      this->liveData->params.auxPerc = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(50, 52).c_str(), 1, false);
-      this->liveData->params.auxCurrentAmp = - this->liveData->hexToDec(this->liveData->responseRowMerged.substring(46, 50).c_str(), 2, true) / 1000.0;
-    }
-  }
-
-  // Cluster module 7c6
-  if (this->liveData->currentAtshRequest.equals("ATSH7C6")) {
-    if (this->liveData->commandRequest.equals("22B002")) {
-      this->liveData->params.odoKm = float(strtol(this->liveData->responseRowMerged.substring(18, 24).c_str(), 0, 16));
-    }
-  }
 
-  // Aircon 7b3
-  if (this->liveData->currentAtshRequest.equals("ATSH7B3")) {
-    if (this->liveData->commandRequest.equals("220100")) {
-      this->liveData->params.indoorTemperature = (this->liveData->hexToDec(this->liveData->responseRowMerged.substring(16, 18).c_str(), 1, false) / 2) - 40;
-      this->liveData->params.outdoorTemperature = (this->liveData->hexToDec(this->liveData->responseRowMerged.substring(18, 20).c_str(), 1, false) / 2) - 40;
-    }
-    if (this->liveData->commandRequest.equals("220102") && this->liveData->responseRowMerged.substring(12, 14) == "00") {
-      this->liveData->params.coolantTemp1C = (this->liveData->hexToDec(this->liveData->responseRowMerged.substring(14, 16).c_str(), 1, false) / 2) - 40;
-      this->liveData->params.coolantTemp2C = (this->liveData->hexToDec(this->liveData->responseRowMerged.substring(16, 18).c_str(), 1, false) / 2) - 40;
-    }
-  }
-
-  // BMS 7e4
-  if (this->liveData->currentAtshRequest.equals("ATSH7E4")) {
-    if (this->liveData->commandRequest.equals("220101")) {
-      this->liveData->params.cumulativeEnergyChargedKWh = float(strtol(this->liveData->responseRowMerged.substring(82, 90).c_str(), 0, 16)) / 10.0;
+    // BMS 7e4
+    case COMMAND_KEY(0x7E4, 0x220101): {
       if (this->liveData->params.cumulativeEnergyChargedKWhStart == -1)
         this->liveData->params.cumulativeEnergyChargedKWhStart = this->liveData->params.cumulativeEnergyChargedKWh;
-      this->liveData->params.cumulativeEnergyDischargedKWh = float(strtol(this->liveData->responseRowMerged.substring(90, 98).c_str(), 0, 16)) / 10.0;
       if (this->liveData->params.cumulativeEnergyDischargedKWhStart == -1)
         this->liveData->params.cumulativeEnergyDischargedKWhStart = this->liveData->params.cumulativeEnergyDischargedKWh;
-      this->liveData->params.availableChargePower = float(strtol(this->liveData->responseRowMerged.substring(16, 20).c_str(), 0, 16)) / 100.0;
-      this->liveData->params.availableDischargePower = float(strtol(this->liveData->responseRowMerged.substring(20, 24).c_str(), 0, 16)) / 100.0;
-      //this->liveData->params.isolationResistanceKOhm = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(118, 122).c_str(), 2, true);
-      this->liveData->params.batFanStatus = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(60, 62).c_str(), 2, true);
-      this->liveData->params.batFanFeedbackHz = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(62, 64).c_str(), 2, true);
-      this->liveData->params.auxVoltage = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(64, 66).c_str(), 2, true) / 10.0;
-      this->liveData->params.batPowerAmp = - this->liveData->hexToDec(this->liveData->responseRowMerged.substring(26, 30).c_str(), 2, true) / 10.0;
-      this->liveData->params.batVoltage = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(30, 34).c_str(), 2, false) / 10.0;
       this->liveData->params.batPowerKw = (this->liveData->params.batPowerAmp * this->liveData->params.batVoltage) / 1000.0;
       if (this->liveData->params.batPowerKw < 0) // Reset charging start time
         this->liveData->params.chargingStartTime = this->liveData->params.currentTime;
       this->liveData->params.batPowerKwh100 = this->liveData->params.batPowerKw / this->liveData->params.speedKmh * 100;
-      this->liveData->params.batCellMaxV = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(52, 54).c_str(), 1, false) / 50.0;
-      this->liveData->params.batCellMinV = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(56, 58).c_str(), 1, false) / 50.0;
-      this->liveData->params.batModuleTempC[0] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(38, 40).c_str(), 1, true);
-      this->liveData->params.batModuleTempC[1] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(40, 42).c_str(), 1, true);
-      this->liveData->params.batModuleTempC[2] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(42, 44).c_str(), 1, true);
-      this->liveData->params.batModuleTempC[3] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(44, 46).c_str(), 1, true);
-      this->liveData->params.motorRpm = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(112, 116).c_str(), 2, false);
-      //this->liveData->params.batTempC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(36, 38).c_str(), 1, true);
-      //this->liveData->params.batMaxC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(34, 36).c_str(), 1, true);
-      //this->liveData->params.batMinC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(36, 38).c_str(), 1, true);
 
       // This is more accurate than min/max from BMS. It's required to detect kona/eniro cold gates (min 15C is needed > 43kW charging, min 25C is needed > 58kW charging)
       this->liveData->params.batMinC = this->liveData->params.batMaxC = this->liveData->params.batModuleTempC[0];
@@ -213,7 +294,6 @@ void CarKiaEniro::parseRowMerged() {
       }
       this->liveData->params.batTempC = this->liveData->params.batMinC;
 
-      this->liveData->params.batInletC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(50, 52).c_str(), 1, true);
       if (this->liveData->params.speedKmh < 10 && this->liveData->params.batPowerKw >= 1 && this->liveData->params.socPerc > 0 && this->liveData->params.socPerc <= 100) {
         if ( this->liveData->params.chargingGraphMinKw[int(this->liveData->params.socPerc)] < 0 || this->liveData->params.batPowerKw < this->liveData->params.chargingGraphMinKw[int(this->liveData->params.socPerc)])
           this->liveData->params.chargingGraphMinKw[int(this->liveData->params.socPerc)] = this->liveData->params.batPowerKw;
@@ -224,30 +304,10 @@ void CarKiaEniro::parseRowMerged() {
         this->liveData->params.chargingGraphHeaterTempC[int(this->liveData->params.socPerc)] = this->liveData->params.batHeaterC;
         this->liveData->params.chargingGraphWaterCoolantTempC[int(this->liveData->params.socPerc)] = this->liveData->params.coolingWaterTempC;
       }
+      break;
     }
-    // BMS 7e4
-    if (this->liveData->commandRequest.equals("220102") && this->liveData->responseRowMerged.substring(12, 14) == "FF") {
-      for (int i = 0; i < 32; i++) {
-        this->liveData->params.cellVoltage[i] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(14 + (i * 2), 14 + (i * 2) + 2).c_str(), 1, false) / 50;
-      }
-    }
-    // BMS 7e4
-    if (this->liveData->commandRequest.equals("220103")) {
-      for (int i = 0; i < 32; i++) {
-        this->liveData->params.cellVoltage[32 + i] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(14 + (i * 2), 14 + (i * 2) + 2).c_str(), 1, false) / 50;
-      }
-    }
-    // BMS 7e4
-    if (this->liveData->commandRequest.equals("220104")) {
-      for (int i = 0; i < 32; i++) {
-        this->liveData->params.cellVoltage[64 + i] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(14 + (i * 2), 14 + (i * 2) + 2).c_str(), 1, false) / 50;
-      }
-    }
-    // BMS 7e4
-    if (this->liveData->commandRequest.equals("220105")) {
-      this->liveData->params.socPercPrevious = this->liveData->params.socPerc;
-      this->liveData->params.sohPerc = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(56, 60).c_str(), 2, false) / 10.0;
-      this->liveData->params.socPerc = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(68, 70).c_str(), 1, false) / 2.0;
+    case COMMAND_KEY(0x7E4, 0x220105): {
+      this->liveData->params.socPercPrevious = socPercPrevious;
 
       // Soc10ced table, record x0% CEC/CED table (ex. 90%->89%, 80%->79%)
       if (this->liveData->params.socPercPrevious - this->liveData->params.socPerc > 0) {
@@ -259,33 +319,7 @@ void CarKiaEniro::parseRowMerged() {
           this->liveData->params.soc10time[index] = this->liveData->params.currentTime;
         }
       }
-      this->liveData->params.bmsUnknownTempA = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(30, 32).c_str(), 1, true);
-      this->liveData->params.batHeaterC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(52, 54).c_str(), 1, true);
-      this->liveData->params.bmsUnknownTempB = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(82, 84).c_str(), 1, true);
-      //
-      for (int i = 30; i < 32; i++) { // ai/aj position
-        this->liveData->params.cellVoltage[96 - 30 + i] = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(14 + (i * 2), 14 + (i * 2) + 2).c_str(), 1, false) / 50;
-      }
-    }
-    // BMS 7e4
-    if (this->liveData->commandRequest.equals("220106")) {
-      this->liveData->params.coolingWaterTempC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(14, 16).c_str(), 1, false);
-      this->liveData->params.bmsUnknownTempC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(18, 20).c_str(), 1, true);
-      this->liveData->params.bmsUnknownTempD = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(46, 48).c_str(), 1, true);
-    }
-  }
-
-  // TPMS 7a0
-  if (this->liveData->currentAtshRequest.equals("ATSH7A0")) {
-    if (this->liveData->commandRequest.equals("22c00b")) {
-      this->liveData->params.tireFrontLeftPressureBar = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(14, 16).c_str(), 2, false) / 72.51886900361;     // === OK Valid *0.2 / 14.503773800722
-      this->liveData->params.tireFrontRightPressureBar = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(22, 24).c_str(), 2, false) / 72.51886900361;     // === OK Valid *0.2 / 14.503773800722
-      this->liveData->params.tireRearRightPressureBar = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(30, 32).c_str(), 2, false) / 72.51886900361;    // === OK Valid *0.2 / 14.503773800722
-      this->liveData->params.tireRearLeftPressureBar = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(38, 40).c_str(), 2, false) / 72.51886900361;     // === OK Valid *0.2 / 14.503773800722
-      this->liveData->params.tireFrontLeftTempC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(16, 18).c_str(), 2, false)  - 50;      // === OK Valid
-      this->liveData->params.tireFrontRightTempC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(24, 26).c_str(), 2, false) - 50;      // === OK Valid
-      this->liveData->params.tireRearRightTempC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(32, 34).c_str(), 2, false) - 50;     // === OK Valid
-      this->liveData->params.tireRearLeftTempC = this->liveData->hexToDec(this->liveData->responseRowMerged.substring(40, 42).c_str(), 2, false) - 50;     // === OK Valid
+      break;
     }
   }
 }
@@ -299,85 +333,85 @@ void CarKiaEniro::loadTestData() {
   this->liveData->currentAtshRequest = "ATSH770";
   // 22BC03
   this->liveData->commandRequest = "22BC03";
-  this->liveData->responseRowMerged = "62BC03FDEE7C730A600000AAAA";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("62BC03FDEE7C730A600000AAAA");
+  this->parseTestResponse();
 
   // ABS / ESP + AHB ATSH7D1
   this->liveData->currentAtshRequest = "ATSH7D1";
   // 2101
   this->liveData->commandRequest = "22C101";
-  this->liveData->responseRowMerged = "62C1015FD7E7D0FFFF00FF04D0D400000000FF7EFF0030F5010000FFFF7F6307F207FE05FF00FF3FFFFFAAAAAAAAAAAA";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("62C1015FD7E7D0FFFF00FF04D0D400000000FF7EFF0030F5010000FFFF7F6307F207FE05FF00FF3FFFFFAAAAAAAAAAAA");
+  this->parseTestResponse();
 
   // VMCU ATSH7E2
   this->liveData->currentAtshRequest = "ATSH7E2";
   // 2101
   this->liveData->commandRequest = "2101";
-  this->liveData->responseRowMerged = "6101FFF8000009285A3B0648030000B4179D763404080805000000";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("6101FFF8000009285A3B0648030000B4179D763404080805000000");
+  this->parseTestResponse();
   // 2102
   this->liveData->commandRequest = "2102";
-  this->liveData->responseRowMerged = "6102F8FFFC000101000000840FBF83BD33270680953033757F59291C76000001010100000007000000";
-  this->liveData->responseRowMerged = "6102F8FFFC000101000000931CC77F4C39040BE09BA7385D8158832175000001010100000007000000";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("6102F8FFFC000101000000840FBF83BD33270680953033757F59291C76000001010100000007000000");
+  this->liveData->setResponseMerged("6102F8FFFC000101000000931CC77F4C39040BE09BA7385D8158832175000001010100000007000000");
+  this->parseTestResponse();
 
   // "ATSH7DF",
   this->liveData->currentAtshRequest = "ATSH7DF";
   // 2106
   this->liveData->commandRequest = "2106";
-  this->liveData->responseRowMerged = "6106FFFF800000000000000200001B001C001C000600060006000E000000010000000000000000013D013D013E013E00";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("6106FFFF800000000000000200001B001C001C000600060006000E000000010000000000000000013D013D013E013E00");
+  this->parseTestResponse();
 
   // AIRCON / ACU ATSH7B3
   this->liveData->currentAtshRequest = "ATSH7B3";
   // 220100
   this->liveData->commandRequest = "220100";
-  this->liveData->responseRowMerged = "6201007E5027C8FF7F765D05B95AFFFF5AFF11FFFFFFFFFFFF6AFFFF2DF0757630FFFF00FFFF000000";
-  this->liveData->responseRowMerged = "6201007E5027C8FF867C58121010FFFF10FF8EFFFFFFFFFFFF10FFFF0DF0617900FFFF01FFFF000000";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("6201007E5027C8FF7F765D05B95AFFFF5AFF11FFFFFFFFFFFF6AFFFF2DF0757630FFFF00FFFF000000");
+  this->liveData->setResponseMerged("6201007E5027C8FF867C58121010FFFF10FF8EFFFFFFFFFFFF10FFFF0DF0617900FFFF01FFFF000000");
+  this->parseTestResponse();
 
   // BMS ATSH7E4
   this->liveData->currentAtshRequest = "ATSH7E4";
   // 220101
   this->liveData->commandRequest = "220101";
-  this->liveData->responseRowMerged = "620101FFF7E7FF99000000000300B10EFE120F11100F12000018C438C30B00008400003864000035850000153A00001374000647010D017F0BDA0BDA03E8";
-  this->liveData->responseRowMerged = "620101FFF7E7FFB3000000000300120F9B111011101011000014CC38CB3B00009100003A510000367C000015FB000013D3000690250D018E0000000003E8";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("620101FFF7E7FF99000000000300B10EFE120F11100F12000018C438C30B00008400003864000035850000153A00001374000647010D017F0BDA0BDA03E8");
+  this->liveData->setResponseMerged("620101FFF7E7FFB3000000000300120F9B111011101011000014CC38CB3B00009100003A510000367C000015FB000013D3000690250D018E0000000003E8");
+  this->parseTestResponse();
   // 220102
   this->liveData->commandRequest = "220102";
-  this->liveData->responseRowMerged = "620102FFFFFFFFCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBAAAA";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("620102FFFFFFFFCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBAAAA");
+  this->parseTestResponse();
   // 220103
   this->liveData->commandRequest = "220103";
-  this->liveData->responseRowMerged = "620103FFFFFFFFCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCACBCACACFCCCBCBCBCBCBCBCBCBAAAA";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("620103FFFFFFFFCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCACBCACACFCCCBCBCBCBCBCBCBCBAAAA");
+  this->parseTestResponse();
   // 220104
   this->liveData->commandRequest = "220104";
-  this->liveData->responseRowMerged = "620104FFFFFFFFCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBAAAA";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("620104FFFFFFFFCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBCBAAAA");
+  this->parseTestResponse();
   // 220105
   this->liveData->commandRequest = "220105";
-  this->liveData->responseRowMerged = "620105003fff9000000000000000000F8A86012B4946500101500DAC03E800000000AC0000C7C701000F00000000AAAA";
-  this->liveData->responseRowMerged = "620105003FFF90000000000000000014918E012927465000015013BB03E800000000BB0000CBCB01001300000000AAAA";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("620105003fff9000000000000000000F8A86012B4946500101500DAC03E800000000AC0000C7C701000F00000000AAAA");
+  this->liveData->setResponseMerged("620105003FFF90000000000000000014918E012927465000015013BB03E800000000BB0000CBCB01001300000000AAAA");
+  this->parseTestResponse();
   // 220106
   this->liveData->commandRequest = "220106";
-  this->liveData->responseRowMerged = "620106FFFFFFFF14001A00240000003A7C86B4B30000000928EA00";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("620106FFFFFFFF14001A00240000003A7C86B4B30000000928EA00");
+  this->parseTestResponse();
 
   // BCM / TPMS ATSH7A0
   this->liveData->currentAtshRequest = "ATSH7A0";
   // 22c00b
   this->liveData->commandRequest = "22c00b";
-  this->liveData->responseRowMerged = "62C00BFFFF0000B93D0100B43E0100B43D0100BB3C0100AAAAAAAA";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("62C00BFFFF0000B93D0100B43E0100B43D0100BB3C0100AAAAAAAA");
+  this->parseTestResponse();
 
   // ATSH7C6
   this->liveData->currentAtshRequest = "ATSH7C6";
   // 22b002
   this->liveData->commandRequest = "22b002";
-  this->liveData->responseRowMerged = "62B002E0000000FFB400330B0000000000000000";
-  this->parseRowMerged();
+  this->liveData->setResponseMerged("62B002E0000000FFB400330B0000000000000000");
+  this->parseTestResponse();
 
   this->liveData->params.batModuleTempC[0] = 28;
   this->liveData->params.batModuleTempC[1] = 29;
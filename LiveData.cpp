@@ -5,16 +5,27 @@
 #include "LiveData.h"
 #include "menu.h"
 
+// Hex char to nibble, non hex chars are 0
+static uint8_t hexNibble[256];
+static bool hexNibbleReady = false;
+
+static void initHexNibble() {
+
+  for (uint16_t i = 0; i < 256; i++)
+    hexNibble[i] = 0;
+  for (uint8_t i = 0; i < 10; i++)
+    hexNibble['0' + i] = i;
+  for (uint8_t i = 0; i < 6; i++)
+    hexNibble['A' + i] = hexNibble['a' + i] = 10 + i;
+  hexNibbleReady = true;
+}
+
 /**
    Init params with default values
 */
 void LiveData::initParams() {
 
   this->params.automaticShutdownTimer = 0;
-#ifdef SIM800L_ENABLED
-  this->params.lastDataSent = 0;
-  this->params.sim800l_enabled = false;
-#endif //SIM800L_ENABLED
   this->params.ignitionOn = false;
   this->params.ignitionOnPrevious = false;
   this->params.chargingStartTime = this->params.currentTime = 0;
@@ -88,6 +99,18 @@ void LiveData::initParams() {
     this->params.cellVoltage[i] = 0;
   }
   this->params.cellCount = 0;
+  this->params.cellStatsMinV = this->params.cellStatsMaxV = -1;
+  this->params.cellStatsMeanV = this->params.cellStatsStdDevV = -1;
+  this->params.cellStatsMinIndex = this->params.cellStatsMaxIndex = 0;
+  for (int i = 0; i < CELL_HISTOGRAM_SIZE; i++) {
+    this->params.cellStatsHistogram[i] = 0;
+  }
+  for (int i = 0; i < CELL_BLOCKS; i++) {
+    this->cellBlockStats[i] = {0, 0, 0, 0, 0, 0};
+  }
+  for (int i = 0; i < CELL_COUNT; i++) {
+    this->cellHistogramBin[i] = CELL_HISTOGRAM_NONE;
+  }
   for (int i = 0; i <= 100; i++) {
     this->params.chargingGraphMinKw[i] = -1;
     this->params.chargingGraphMaxKw[i] = -1;
@@ -97,8 +120,562 @@ void LiveData::initParams() {
     this->params.chargingGraphWaterCoolantTempC[i] = -100;
   }
 
+  // Response buffers, allocated once
+  this->responseRingHead = this->responseRingTail = 0;
+  this->responseRowLength = 0;
+  this->responseRow[0] = '\0';
+  this->responseRowMerged[0] = '\0';
+  this->responseRowMergedLength = 0;
+  this->responsePayloadLength = 0;
+  memset(&this->commandSent, 0, sizeof(COMMAND_SENT));
+  this->responseRequest[0] = '\0';
+  this->debugResponse[0] = this->debugRequest[0] = '\0';
+  if (!hexNibbleReady)
+    initHexNibble();
+
   // Menu
   this->menuItems = menuItemsSource;
+  this->initMenuIndex();
+}
+
+/**
+  Build parent -> children index of static menu (item order within parent is kept)
+*/
+void LiveData::initMenuIndex() {
+
+  uint8_t pos = 0;
+
+  this->menuParentsCount = 0;
+  for (uint16_t i = 0; i < this->menuItemsCount; i++) {
+    int16_t parentId = this->menuItems[i].parentId;
+    // Sorted insert of new parent
+    uint8_t p = 0;
+    while (p < this->menuParentsCount && this->menuParents[p].parentId < parentId)
+      p++;
+    if (p < this->menuParentsCount && this->menuParents[p].parentId == parentId)
+      continue;
+    for (uint8_t j = this->menuParentsCount; j > p; j--)
+      this->menuParents[j] = this->menuParents[j - 1];
+    this->menuParentsCount++;
+    // Children in source order
+    this->menuParents[p].parentId = parentId;
+    this->menuParents[p].from = pos;
+    this->menuParents[p].count = 0;
+    for (uint16_t j = i; j < this->menuItemsCount; j++) {
+      if (this->menuItems[j].parentId == parentId) {
+        this->menuChildren[pos++] = j;
+        this->menuParents[p].count++;
+      }
+    }
+  }
+
+  this->setMenuCurrent(this->menuCurrent);
+}
+
+/**
+  Open menu level (binary search in parent index)
+*/
+void LiveData::setMenuCurrent(uint16_t parentId) {
+
+  int16_t lo = 0, hi = this->menuParentsCount - 1;
+
+  this->menuCurrent = parentId;
+  this->menuChildrenFrom = 0;
+  this->menuChildrenCount = 0;
+  while (lo <= hi) {
+    int16_t mid = (lo + hi) / 2;
+    if (this->menuParents[mid].parentId == (int16_t)parentId) {
+      this->menuChildrenFrom = this->menuParents[mid].from;
+      this->menuChildrenCount = this->menuParents[mid].count;
+      return;
+    }
+    if (this->menuParents[mid].parentId < (int16_t)parentId)
+      lo = mid + 1;
+    else
+      hi = mid - 1;
+  }
+}
+
+/**
+  Child item of current menu level
+*/
+MENU_ITEM* LiveData::menuChild(uint8_t position) {
+
+  if (position >= this->menuChildrenCount)
+    return NULL;
+  return &this->menuItems[this->menuChildren[this->menuChildrenFrom + position]];
+}
+
+/**
+  Update cell statistics after cells from..from+count were parsed
+  Only changed blocks of 32 cells are scanned, totals are combined from block aggregates
+*/
+void LiveData::updateCellStats(uint16_t from, uint16_t count) {
+
+  if (count == 0 || from >= CELL_COUNT)
+    return;
+  if (from + count > CELL_COUNT)
+    count = CELL_COUNT - from;
+
+  for (uint8_t b = from / CELL_BLOCK_SIZE; b <= (from + count - 1) / CELL_BLOCK_SIZE; b++) {
+    CELL_BLOCK_STATS* block = &this->cellBlockStats[b];
+    *block = {0, 0, 0, 0, 0, 0};
+    uint8_t last = (b + 1) * CELL_BLOCK_SIZE;
+    if (last > CELL_COUNT)
+      last = CELL_COUNT;
+    for (uint8_t i = b * CELL_BLOCK_SIZE; i < last; i++) {
+      float v = this->params.cellVoltage[i];
+      // Histogram
+      uint8_t bin = CELL_HISTOGRAM_NONE;
+      if (v > 0) {
+        int16_t n = (v - CELL_HISTOGRAM_FROM_V) / CELL_HISTOGRAM_STEP_V + 0.5;
+        bin = (n < 0) ? 0 : (n >= CELL_HISTOGRAM_SIZE) ? CELL_HISTOGRAM_SIZE - 1 : n;
+      }
+      if (bin != this->cellHistogramBin[i]) {
+        if (this->cellHistogramBin[i] != CELL_HISTOGRAM_NONE)
+          this->params.cellStatsHistogram[this->cellHistogramBin[i]]--;
+        if (bin != CELL_HISTOGRAM_NONE)
+          this->params.cellStatsHistogram[bin]++;
+        this->cellHistogramBin[i] = bin;
+      }
+      // Block aggregates
+      if (v <= 0)
+        continue;
+      if (block->count == 0 || v < this->params.cellVoltage[block->minIndex])
+        block->minIndex = i;
+      if (block->count == 0 || v > this->params.cellVoltage[block->maxIndex])
+        block->maxIndex = i;
+      block->lastIndex = i;
+      block->count++;
+      // Sums relative to CELL_HISTOGRAM_FROM_V (float precision of variance)
+      block->sum += v - CELL_HISTOGRAM_FROM_V;
+      block->sumSq += (v - CELL_HISTOGRAM_FROM_V) * (v - CELL_HISTOGRAM_FROM_V);
+    }
+  }
+
+  // Totals
+  uint8_t cells = 0;
+  float sum = 0, sumSq = 0;
+  for (uint8_t b = 0; b < CELL_BLOCKS; b++) {
+    CELL_BLOCK_STATS* block = &this->cellBlockStats[b];
+    if (block->count == 0)
+      continue;
+    if (cells == 0 || this->params.cellVoltage[block->minIndex] < this->params.cellVoltage[this->params.cellStatsMinIndex])
+      this->params.cellStatsMinIndex = block->minIndex;
+    if (cells == 0 || this->params.cellVoltage[block->maxIndex] > this->params.cellVoltage[this->params.cellStatsMaxIndex])
+      this->params.cellStatsMaxIndex = block->maxIndex;
+    this->params.cellCount = block->lastIndex + 1;
+    cells += block->count;
+    sum += block->sum;
+    sumSq += block->sumSq;
+  }
+  if (cells == 0)
+    return;
+
+  this->params.cellStatsMinV = this->params.cellVoltage[this->params.cellStatsMinIndex];
+  this->params.cellStatsMaxV = this->params.cellVoltage[this->params.cellStatsMaxIndex];
+  float mean = sum / cells;
+  float variance = (sumSq / cells) - (mean * mean);
+  this->params.cellStatsMeanV = CELL_HISTOGRAM_FROM_V + mean;
+  this->params.cellStatsStdDevV = (variance > 0) ? sqrt(variance) : 0;
+}
+
+/**
+  Publish params (single writer - parser task), writer never waits for readers
+  Sequence is odd while copy is in progress
+*/
+void LiveData::publishParams() {
+
+  uint32_t seq = this->paramsSeq;
+
+  __atomic_store_n(&this->paramsSeq, seq + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  memcpy(&this->paramsPublished, &this->params, sizeof(PARAMS_STRUC));
+  __atomic_store_n(&this->paramsSeq, seq + 2, __ATOMIC_RELEASE);
+  this->newParamsPublished = true;
+}
+
+/**
+  Consistent copy of published params (retry if publish was in progress)
+*/
+void LiveData::readParams(PARAMS_STRUC &dest) {
+
+  for (;;) {
+    uint32_t seq = __atomic_load_n(&this->paramsSeq, __ATOMIC_ACQUIRE);
+    if (seq & 1)
+      continue;
+    memcpy(&dest, &this->paramsPublished, sizeof(PARAMS_STRUC));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&this->paramsSeq, __ATOMIC_RELAXED) == seq)
+      return;
+  }
+}
+
+/**
+  Copy of seqlock data by 32 bit words (relaxed atomics, may be torn - sequence decides)
+*/
+static void copyWords(void* dest, const void* src, size_t size) {
+
+  for (size_t i = 0; i < size / 4; i++)
+    __atomic_store_n((uint32_t*)dest + i, __atomic_load_n((const uint32_t*)src + i, __ATOMIC_RELAXED), __ATOMIC_RELAXED);
+}
+
+/**
+  Sent command for parser task (main loop), request is copied without \r
+*/
+void LiveData::publishCommand(const char* request, uint8_t length, uint64_t key, bool debug) {
+
+  COMMAND_SENT sent;
+  uint32_t seq = this->commandSentSeq;
+
+  if (length > COMMAND_REQUEST_SIZE - 1)
+    length = COMMAND_REQUEST_SIZE - 1;
+  if (length > 0 && request[length - 1] == '\r')
+    length--;
+  memset(&sent, 0, sizeof(sent));
+  memcpy(sent.request, request, length);
+  sent.key = key;
+  sent.debug = debug;
+
+  __atomic_store_n(&this->commandSentSeq, seq + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  copyWords(&this->commandSent, &sent, sizeof(COMMAND_SENT));
+  __atomic_store_n(&this->commandSentSeq, seq + 2, __ATOMIC_RELEASE);
+}
+
+/**
+  Command of response being parsed (parser task), consistent copy of last sent command
+*/
+void LiveData::readCommand() {
+
+  COMMAND_SENT sent;
+
+  for (;;) {
+    uint32_t seq = __atomic_load_n(&this->commandSentSeq, __ATOMIC_ACQUIRE);
+    if (seq & 1)
+      continue;
+    copyWords(&sent, &this->commandSent, sizeof(COMMAND_SENT));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&this->commandSentSeq, __ATOMIC_RELAXED) == seq)
+      break;
+  }
+  memcpy(this->responseRequest, sent.request, COMMAND_REQUEST_SIZE);
+  this->commandKey = sent.key;
+  this->responseDebug = sent.debug;
+}
+
+/**
+  Activate command table of car (no copy, only lengths are computed)
+*/
+void LiveData::setCommandQueue(const char* const* commands, uint16_t count, uint16_t loopFrom) {
+
+  this->commandQueue = commands;
+  this->commandQueueCount = (count > COMMAND_QUEUE_SIZE) ? COMMAND_QUEUE_SIZE : count;
+  this->commandQueueLoopFrom = loopFrom;
+  for (uint16_t i = 0; i < COMMAND_QUEUE_SIZE; i++)
+    this->commandQueueStreamed[i] = false;
+  for (uint16_t i = 0; i < this->commandQueueCount; i++) {
+    const char* end = strchr(commands[i], '\r');
+    this->commandQueueLength[i] = (end == NULL) ? strlen(commands[i]) : end - commands[i];
+  }
+}
+
+/**
+  ECU headers (ATSH entries) accepting flow control with block size 0 and STmin 0
+*/
+void LiveData::setFlowControlHeaders(const char* const* headers, uint8_t count) {
+
+  this->flowControlHeaders = headers;
+  this->flowControlHeadersCount = (count > FLOW_CONTROL_HEADERS_MAX) ? FLOW_CONTROL_HEADERS_MAX : count;
+  for (uint8_t i = 0; i < FLOW_CONTROL_HEADERS_MAX; i++)
+    this->flowControlDisabled[i] = false;
+  this->flowControlHeader = -1;
+}
+
+/**
+  Broadcast arbitration ids received in monitor mode (signal rows with MONITOR_KEY)
+*/
+void LiveData::setMonitorIds(const uint16_t* ids, uint8_t count) {
+
+  this->monitorIdsCount = 0;
+  for (uint8_t i = 0; i < count; i++)
+    this->addMonitorId(ids[i]);
+  this->monitorIdIndex = 0;
+  this->monitorStep = MONITOR_STEP_IDLE;
+  this->monitorOverrun = false;
+  this->monitorFailures = 0;
+  this->monitorRetryMs = 0;
+}
+
+/**
+  Add arbitration id to monitor bursts (once, ignored if full)
+*/
+void LiveData::addMonitorId(uint16_t id) {
+
+  for (uint8_t i = 0; i < this->monitorIdsCount; i++)
+    if (this->monitorIds[i] == id)
+      return;
+  if (this->monitorIdsCount < MONITOR_IDS_MAX)
+    this->monitorIds[this->monitorIdsCount++] = id;
+}
+
+/**
+  Periodic DIDs of car (subscribed once, polled command is skipped while stream is active)
+  Response ids are added to monitor ids (call after setMonitorIds)
+*/
+void LiveData::setPeriodicDids(const PERIODIC_DID* dids, uint8_t count) {
+
+  this->periodicDids = dids;
+  this->periodicDidsCount = (count > PERIODIC_DIDS_MAX) ? PERIODIC_DIDS_MAX : count;
+  for (uint8_t i = 0; i < PERIODIC_DIDS_MAX; i++) {
+    this->periodicState[i] = PERIODIC_STATE_UNKNOWN;
+    this->periodicLastFrameMs[i] = 0;
+  }
+  for (uint8_t i = 0; i < this->periodicDidsCount; i++)
+    this->addMonitorId(dids[i].rxId);
+  this->periodicStep = PERIODIC_STEP_IDLE;
+}
+
+/**
+  Skip/restore polling of command replaced by periodic DID
+*/
+void LiveData::setCommandStreamed(uint64_t key, bool streamed) {
+
+  for (uint16_t i = 0; i < this->commandQueueCount; i++)
+    if (this->commandQueueKey[i] == key)
+      this->commandQueueStreamed[i] = streamed;
+}
+
+/**
+  Frame of active periodic DID received (stale detection)
+*/
+void LiveData::periodicFrameReceived(uint16_t id, uint8_t periodicId) {
+
+  for (uint8_t i = 0; i < this->periodicDidsCount; i++)
+    if (this->periodicState[i] == PERIODIC_STATE_ACTIVE && this->periodicDids[i].rxId == id && this->periodicDids[i].periodicId == periodicId)
+      this->periodicLastFrameMs[i] = millis();
+}
+
+/**
+  Apply refresh rates to command queue (after queue is filled)
+  Hot values (power, speed) stay at 0 = every loop, slow values are requested every N ms
+  Numeric keys (header + command) are precomputed for response dispatch
+*/
+void LiveData::applyCommandSchedule(const COMMAND_SCHEDULE* schedule, uint16_t scheduleCount) {
+
+  const char* atshRequest = "";
+  uint8_t atshLength = 0;
+
+  for (uint16_t i = 0; i < COMMAND_QUEUE_SIZE; i++) {
+    this->commandQueueRefreshMs[i] = 0;
+    this->commandQueueLastSentMs[i] = 0;
+    this->commandQueueSignals[i] = 0;
+    this->commandQueueKey[i] = 0;
+  }
+
+  for (uint16_t i = 0; i < this->commandQueueCount; i++) {
+    const char* command = this->commandQueue[i];
+    uint8_t length = this->commandQueueLength[i];
+    if (strncmp(command, "ATSH", 4) == 0) {
+      atshRequest = command;
+      atshLength = length;
+      continue;
+    }
+    this->commandQueueKey[i] = this->makeCommandKey(atshRequest, command);
+    for (uint16_t j = 0; j < scheduleCount; j++) {
+      if (strlen(schedule[j].atshRequest) == atshLength && strncmp(atshRequest, schedule[j].atshRequest, atshLength) == 0 &&
+          strlen(schedule[j].commandRequest) == length && strncasecmp(command, schedule[j].commandRequest, length) == 0) {
+        this->commandQueueRefreshMs[i] = schedule[j].refreshMs;
+        this->commandQueueSignals[i] = schedule[j].signals;
+        break;
+      }
+    }
+  }
+}
+
+/**
+  Numeric key of request (COMMAND_KEY), 0 for AT commands and invalid hex
+*/
+uint64_t LiveData::makeCommandKey(const char* atshRequest, const char* commandRequest) {
+
+  uint32_t header = 0;
+  uint32_t command = 0;
+
+  if (!hexNibbleReady)
+    initHexNibble();
+  if (strncmp(commandRequest, "AT", 2) == 0 || strncmp(atshRequest, "ATSH", 4) != 0)
+    return 0;
+  for (const char* ch = atshRequest + 4; *ch != '\0' && *ch != '\r'; ch++) {
+    if (!isxdigit(*ch))
+      return 0;
+    header = (header << 4) | hexNibble[(uint8_t)*ch];
+  }
+  for (const char* ch = commandRequest; *ch != '\0' && *ch != '\r'; ch++) {
+    if (*ch == ' ')
+      continue;
+    if (!isxdigit(*ch))
+      return 0;
+    command = (command << 4) | hexNibble[(uint8_t)*ch];
+  }
+
+  return COMMAND_KEY(header, command);
+}
+
+/**
+  Command is due (refresh rate elapsed)
+  ATSH is due only if any command of its group is due
+*/
+bool LiveData::isCommandDue(uint16_t index, unsigned long now) {
+
+  if (index < this->commandQueueLoopFrom)
+    return true;
+
+  // Values are streamed by periodic DID
+  if (this->commandQueueStreamed[index])
+    return false;
+
+  if (strncmp(this->commandQueue[index], "ATSH", 4) == 0) {
+    for (uint16_t i = index + 1; i < this->commandQueueCount && strncmp(this->commandQueue[i], "ATSH", 4) != 0; i++) {
+      if (this->isCommandDue(i, now))
+        return true;
+    }
+    return false;
+  }
+
+  // Nobody is interested in values of this command
+  if (this->commandQueueSignals[index] != 0 && (this->commandQueueSignals[index] & this->subscribedSignals) == 0)
+    return false;
+
+  return (this->commandQueueRefreshMs[index] == 0 || this->commandQueueLastSentMs[index] == 0 ||
+          now - this->commandQueueLastSentMs[index] >= this->commandQueueRefreshMs[index]);
+}
+
+/**
+  Earliest refresh time of polled commands, at most COMMAND_IDLE_MAX_MS from now
+*/
+unsigned long LiveData::nextCommandDueMs(unsigned long now) {
+
+  unsigned long dueMs = now + COMMAND_IDLE_MAX_MS;
+
+  for (uint16_t i = this->commandQueueLoopFrom; i < this->commandQueueCount; i++) {
+    if (strncmp(this->commandQueue[i], "AT", 2) == 0 || this->commandQueueStreamed[i])
+      continue;
+    if (this->commandQueueSignals[i] != 0 && (this->commandQueueSignals[i] & this->subscribedSignals) == 0)
+      continue;
+    if ((long)(this->commandQueueLastSentMs[i] + this->commandQueueRefreshMs[i] - dueMs) < 0)
+      dueMs = this->commandQueueLastSentMs[i] + this->commandQueueRefreshMs[i];
+  }
+
+  return dueMs;
+}
+
+/**
+  Subscribe signals (union of visible screen, uploads and background signals)
+  Commands of newly subscribed signals are requested immediately
+*/
+void LiveData::subscribeSignals(uint32_t signals) {
+
+  signals |= this->backgroundSignals;
+  if (signals == this->subscribedSignals)
+    return;
+
+  for (uint16_t i = this->commandQueueLoopFrom; i < this->commandQueueCount; i++) {
+    if ((this->commandQueueSignals[i] & signals & ~this->subscribedSignals) != 0)
+      this->commandQueueLastSentMs[i] = 0;
+  }
+  this->subscribedSignals = signals;
+  // Idle queue requests newly subscribed commands now
+  if (this->commandQueueIdleMs != 0)
+    this->commandQueueIdleMs = millis();
+}
+
+/**
+  Store received bytes to ring buffer (BLE task, single producer)
+  Notification is stored whole or dropped (counted) if parser is not fast enough
+*/
+bool LiveData::pushResponseBytes(const uint8_t* data, size_t length) {
+
+  uint16_t head = __atomic_load_n(&this->responseRingHead, __ATOMIC_RELAXED);
+  uint16_t tail = __atomic_load_n(&this->responseRingTail, __ATOMIC_ACQUIRE);
+  uint16_t space = (tail + RESPONSE_RING_SIZE - head - 1) % RESPONSE_RING_SIZE;
+
+  if (length > space) {
+    this->responseRingOverflows++;
+    return false;
+  }
+  for (size_t i = 0; i < length; i++) {
+    this->responseRing[head] = data[i];
+    head = (head + 1) % RESPONSE_RING_SIZE;
+  }
+  // Publish bytes to parser
+  __atomic_store_n(&this->responseRingHead, head, __ATOMIC_RELEASE);
+
+  return true;
+}
+
+/**
+  Read next received byte from ring buffer (parser task, single consumer)
+*/
+bool LiveData::popResponseByte(uint8_t &ch) {
+
+  uint16_t tail = __atomic_load_n(&this->responseRingTail, __ATOMIC_RELAXED);
+
+  if (tail == __atomic_load_n(&this->responseRingHead, __ATOMIC_ACQUIRE))
+    return false;
+  ch = this->responseRing[tail];
+  __atomic_store_n(&this->responseRingTail, (uint16_t)((tail + 1) % RESPONSE_RING_SIZE), __ATOMIC_RELEASE);
+
+  return true;
+}
+
+/**
+  Replace merged response (single frame, test data)
+*/
+void LiveData::setResponseMerged(const char* hex) {
+
+  this->responseRowMergedLength = 0;
+  this->appendResponseMerged(hex, strlen(hex));
+}
+
+/**
+  Append hex chars of next frame, never grows above fixed buffer (frame is dropped)
+*/
+void LiveData::appendResponseMerged(const char* hex, uint16_t length) {
+
+  if (this->responseRowMergedLength + length < RESPONSE_MERGED_SIZE) {
+    memcpy(this->responseRowMerged + this->responseRowMergedLength, hex, length);
+    this->responseRowMergedLength += length;
+  }
+  this->responseRowMerged[this->responseRowMergedLength] = '\0';
+}
+
+/**
+  Decode merged response (hex string) to payload bytes, called once per response
+*/
+void LiveData::decodeResponse() {
+
+  const char* hex = this->responseRowMerged;
+  uint16_t length = this->responseRowMergedLength / 2;
+
+  if (!hexNibbleReady)
+    initHexNibble();
+  if (length > RESPONSE_PAYLOAD_SIZE)
+    length = RESPONSE_PAYLOAD_SIZE;
+  for (uint16_t i = 0; i < length; i++) {
+    this->responsePayload[i] = (hexNibble[(uint8_t)hex[i * 2]] << 4) | hexNibble[(uint8_t)hex[i * 2 + 1]];
+  }
+  this->responsePayloadLength = length;
+}
+
+/**
+  Two hex chars to byte
+*/
+uint8_t LiveData::hexToByte(const char* hex) {
+
+  if (!hexNibbleReady)
+    initHexNibble();
+
+  return (hexNibble[(uint8_t)hex[0]] << 4) | hexNibble[(uint8_t)hex[1]];
 }
 
 /**
@@ -108,15 +685,12 @@ void LiveData::initParams() {
 float LiveData::hexToDec(String hexString, byte bytes, bool signedNum) {
 
   unsigned int decValue = 0;
-  unsigned int nextInt;
-
-  for (int i = 0; i < hexString.length(); i++) {
-    nextInt = int(hexString.charAt(i));
-    if (nextInt >= 48 && nextInt <= 57) nextInt = map(nextInt, 48, 57, 0, 9);
-    if (nextInt >= 65 && nextInt <= 70) nextInt = map(nextInt, 65, 70, 10, 15);
-    if (nextInt >= 97 && nextInt <= 102) nextInt = map(nextInt, 97, 102, 10, 15);
-    nextInt = constrain(nextInt, 0, 15);
-    decValue = (decValue * 16) + nextInt;
+  const char* hex = hexString.c_str();
+
+  if (!hexNibbleReady)
+    initHexNibble();
+  for (unsigned int i = 0; i < hexString.length(); i++) {
+    decValue = (decValue << 4) | hexNibble[(uint8_t)hex[i]];
   }
 
   // Unsigned - do nothing
@@ -29,15 +29,43 @@
 #define SCREEN_SOC10  6
 #define SCREEN_DEBUG  7
 
-// Structure with realtime values
+// SIGNALS (data groups provided by commands, consumed by screens/uploads)
+#define SIGNAL_DRIVE_MODE   0x0001
+#define SIGNAL_LIGHTS       0x0002  // ignition, head/day lights
+#define SIGNAL_BRAKE_LIGHTS 0x0004
+#define SIGNAL_SPEED        0x0008
+#define SIGNAL_AUX          0x0010
+#define SIGNAL_BATTERY      0x0020  // power, voltage, module temps, cumulative energy
+#define SIGNAL_CELLS        0x0040
+#define SIGNAL_SOC          0x0080  // soc, soh, heater
+#define SIGNAL_COOLANT      0x0100  // bms cooling water
+#define SIGNAL_AIRCON       0x0200  // in/out temp, coolant temp
+#define SIGNAL_TIRES        0x0400
+#define SIGNAL_ODO          0x0800
+#define SIGNAL_ALL          0xFFFFFFFF
+// Requested on every screen (automatic shutdown, lights off warning, soc10 table)
+#define SIGNAL_BACKGROUND   (SIGNAL_DRIVE_MODE | SIGNAL_LIGHTS | SIGNAL_BATTERY | SIGNAL_SOC | SIGNAL_ODO)
+
+// Response parser buffers (preallocated, BLE notifications must not touch heap)
+#define RESPONSE_RING_SIZE    1024  // received bytes waiting for parser
+#define RESPONSE_ROW_SIZE     128   // single line (0:xxxx..)
+#define RESPONSE_MERGED_SIZE  1024  // merged multiframe response (hex chars)
+#define RESPONSE_PAYLOAD_SIZE (RESPONSE_MERGED_SIZE / 2) // decoded response (bytes)
+
+// Cell statistics (98 cells, blocks of 32 cells per command)
+#define CELL_COUNT 98
+#define CELL_BLOCK_SIZE 32
+#define CELL_BLOCKS 4
+#define CELL_HISTOGRAM_SIZE 64
+#define CELL_HISTOGRAM_FROM_V 3.00
+#define CELL_HISTOGRAM_STEP_V 0.02
+#define CELL_HISTOGRAM_NONE 0xFF
+
+// Structure with realtime values (written by parser task only)
 typedef struct {
-  time_t currentTime;
+  time_t currentTime; // clockTime of main loop at parsed response
   time_t chargingStartTime;
   time_t automaticShutdownTimer;
-#ifdef SIM800L_ENABLED
-  time_t lastDataSent;
-  bool sim800l_enabled;
-#endif //SIM800L_ENABLED
   bool ignitionOn;
   bool ignitionOnPrevious;
   bool forwardDriveMode;
@@ -100,6 +128,14 @@ typedef struct {
   float tireRearRightPressureBar;
   uint16_t cellCount;
   float cellVoltage[98]; // 1..98 has index 0..97
+  // Cell statistics (cells with voltage > 0), updated by parser
+  float cellStatsMinV;
+  float cellStatsMaxV;
+  float cellStatsMeanV;
+  float cellStatsStdDevV;
+  uint8_t cellStatsMinIndex;
+  uint8_t cellStatsMaxIndex;
+  uint8_t cellStatsHistogram[CELL_HISTOGRAM_SIZE]; // cells by voltage, CELL_HISTOGRAM_FROM_V + bin * CELL_HISTOGRAM_STEP_V
   // Screen - charging graph
   float chargingGraphMinKw[101]; // 0..100% .. Min power Kw
   float chargingGraphMaxKw[101]; // 0..100% .. Max power Kw
@@ -148,6 +184,65 @@ typedef struct {
 #endif //SIM800L_ENABLED
 } SETTINGS_STRUC;
 
+// Command queue (indexes into car command table)
+#define COMMAND_QUEUE_SIZE 300
+#define COMMAND_REQUEST_SIZE 24
+#define FLOW_CONTROL_UNKNOWN -1
+
+// Key of broadcast frame received in monitor mode (ATCRA id + ATMA)
+#define MONITOR_KEY(id) COMMAND_KEY(id, 0)
+#define MONITOR_STEP_IDLE 0
+#define MONITOR_STEP_CAF_OFF 1
+#define MONITOR_STEP_FILTER 2
+#define MONITOR_STEP_MONITOR 3
+#define MONITOR_STEP_RESTORE 4
+#define MONITOR_STEP_CAF_ON 5
+
+// Periodic DID (UDS ReadDataByPeriodicIdentifier), frames are received in monitor mode on rxId
+// Decoded by signal rows MONITOR_KEY(rxId) with matchByte 0 == periodicId
+typedef struct {
+  const char* atshRequest;  // ATSH of ECU, ends with \r
+  uint16_t rxId;            // response id, added to monitor ids
+  uint8_t periodicId;       // low byte of DID 0xF2xx, first byte of periodic frame
+  uint64_t pollKey;         // COMMAND_KEY of polled command replaced by stream
+} PERIODIC_DID;
+
+#define PERIODIC_STATE_UNKNOWN 0
+#define PERIODIC_STATE_PENDING 1
+#define PERIODIC_STATE_ACTIVE 2
+#define PERIODIC_STATE_REJECTED 3
+#define PERIODIC_STEP_IDLE 0
+#define PERIODIC_STEP_REQUEST 1
+#define PERIODIC_STEP_RESULT 2
+
+// Sent command for parser task (copied by 32 bit words)
+typedef struct {
+  char request[COMMAND_REQUEST_SIZE]; // without \r
+  uint64_t key;                       // COMMAND_KEY, 0 for AT commands
+  uint32_t debug;                     // response is shown on debug screen
+} COMMAND_SENT;
+
+// Numeric key of request, CAN header + command (ATSH7E4 + 220101 -> 0x7E400220101)
+#define COMMAND_KEY(header, command) ((((uint64_t)(header)) << 32) | (uint32_t)(command))
+
+// Command refresh rate (scheduler), commands without record are requested every loop
+typedef struct {
+  const char* atshRequest;
+  const char* commandRequest;
+  uint16_t refreshMs; // min. delay between two requests
+  uint32_t signals; // SIGNAL_xxx provided by command
+} COMMAND_SCHEDULE;
+
+// Aggregates of one block of cells
+typedef struct {
+  uint8_t count;
+  uint8_t lastIndex;
+  uint8_t minIndex;
+  uint8_t maxIndex;
+  float sum;
+  float sumSq;
+} CELL_BLOCK_STATS;
+
 
 //
 class LiveData {
@@ -156,21 +251,110 @@ class LiveData {
     // Command loop
     uint16_t commandQueueCount;
     uint16_t commandQueueLoopFrom;
-    String commandQueue[300];
-    String responseRow;
-    String responseRowMerged;
+    const char* const* commandQueue = NULL; // flash table of car, commands end with \r
+    uint8_t commandQueueLength[COMMAND_QUEUE_SIZE]; // without \r
+    uint16_t commandQueueRefreshMs[COMMAND_QUEUE_SIZE];
+    unsigned long commandQueueLastSentMs[COMMAND_QUEUE_SIZE];
+    uint32_t commandQueueSignals[COMMAND_QUEUE_SIZE]; // 0 - always requested
+    uint64_t commandQueueKey[COMMAND_QUEUE_SIZE]; // COMMAND_KEY, 0 for AT commands
+    volatile bool commandQueueStreamed[COMMAND_QUEUE_SIZE]; // values come from periodic DID, not polled
+    uint32_t subscribedSignals = SIGNAL_ALL;
+    uint32_t backgroundSignals = SIGNAL_BACKGROUND;
+    // Response ring buffer (written by BLE task, read by parser task, lock-free)
+    uint8_t responseRing[RESPONSE_RING_SIZE];
+    volatile uint16_t responseRingHead = 0;
+    volatile uint16_t responseRingTail = 0;
+    uint32_t responseRingOverflows = 0;
+    char responseRow[RESPONSE_ROW_SIZE];
+    uint16_t responseRowLength = 0;
+    char responseRowMerged[RESPONSE_MERGED_SIZE]; // hex chars of 0:xxxx 1:yyyy frames
+    uint16_t responseRowMergedLength = 0;
+    uint8_t responsePayload[RESPONSE_PAYLOAD_SIZE]; // responseRowMerged decoded to bytes
+    uint16_t responsePayloadLength = 0;
+    // ISO-TP length of multi frame response (first line "03E"), merged row is parsed as soon as it is complete
+    uint16_t responseExpectedLength = 0;
+    bool responseCompleted = false;
+    unsigned long responseCompletedMs = 0;
+    unsigned long promptLatencyMs = 0; // last delay of prompt after complete response
+    uint32_t responseEarlyCompleted = 0;
+    uint32_t responseMismatches = 0; // DID of response differs from request (late response)
+    uint8_t responseNextFrame = 0; // ISO-TP sequence of next N: line
+    uint32_t responseFramesDropped = 0; // out of sequence N: or length line during merge (other message on same id)
     uint16_t commandQueueIndex;
-    bool canSendNextAtCommand = false;
-    String commandRequest = "";
+    volatile bool canSendNextAtCommand = false;
+    unsigned long commandQueueIdleMs = 0; // no command due, queue is scanned again at this time (0 - not idle)
+    uint32_t commandQueueIdles = 0;
+    // Command watchdog (deadline of sent command, 0 - none)
+    unsigned long commandDeadlineMs = 0;
+    unsigned long commandSentMs = 0;
+    uint8_t commandRetry = 0;
+    uint32_t commandTimeouts = 0;
+    uint32_t commandRetries = 0;
+    uint32_t commandSkips = 0;
+    unsigned long commandStallMs = 0; // last recovery time (send -> resend/skip)
+    // Last written command (with \r), resent by watchdog
+    char commandInFlight[COMMAND_REQUEST_SIZE];
+    uint8_t commandInFlightLength = 0;
+    unsigned long commandInFlightTimeoutMs = 0;
+    // Prompts expected (last write + late prompt of previous write after timeout), only last one releases next command
+    volatile uint32_t commandPromptsPending = 0; // main loop adds, parser task takes (atomic)
+    uint32_t commandStalePrompts = 0;
+    // Header active in adapter (commandQueue entry of last ATSH, NULL - unknown after reset/timeout)
+    const char* adapterAtsh = NULL;
+    uint16_t atshSwitches = 0; // ATSH sent in current loop
+    uint16_t atshSwitchesLastLoop = 0;
+    uint32_t atshElided = 0;
+    // Fast flow control (ATFCSM2 + ATFCSD300000) for ECU headers tolerating it
+    const char* const* flowControlHeaders = NULL; // ATSH entries of car
+    uint8_t flowControlHeadersCount = 0;
+    volatile bool flowControlDisabled[FLOW_CONTROL_HEADERS_MAX]; // truncated response, default flow control
+    int8_t flowControlHeader = -1; // active header in flowControlHeaders, -1 other
+    int8_t flowControlMode = FLOW_CONTROL_UNKNOWN; // FCSM of adapter
+    bool flowControlData = false; // FCSD sent after reset
+    uint32_t flowControlFallbacks = 0;
+    // Monitor mode (broadcast frames between poll loops)
+    uint16_t monitorIds[MONITOR_IDS_MAX]; // arbitration ids of car and rx ids of periodic DIDs
+    uint8_t monitorIdsCount = 0;
+    uint8_t monitorIdIndex = 0;
+    uint8_t monitorStep = MONITOR_STEP_IDLE;
+    volatile bool monitorActive = false; // ATMA running, rows are frames
+    volatile bool monitorOverrun = false; // BUFFER FULL or timeout in current burst
+    uint8_t monitorFailures = 0; // consecutive failed bursts
+    unsigned long monitorRetryMs = 0; // no burst before (backoff)
+    uint8_t monitorStops = 0; // bare \r sent after timeout of ATMA
+    unsigned long monitorEndMs = 0;
+    uint32_t monitorFrames = 0;
+    // Periodic DIDs (0x2A)
+    const PERIODIC_DID* periodicDids = NULL;
+    uint8_t periodicDidsCount = 0;
+    volatile uint8_t periodicState[PERIODIC_DIDS_MAX];
+    volatile unsigned long periodicLastFrameMs[PERIODIC_DIDS_MAX];
+    uint8_t periodicIndex = 0; // DID being subscribed
+    uint8_t periodicStep = PERIODIC_STEP_IDLE;
+    uint32_t periodicFallbacks = 0;
+    String commandRequest = ""; // main loop only (serial, debug screen)
     String currentAtshRequest = "";
+    // Sent command for parser task, fixed at send time (seqlock, odd while written)
+    COMMAND_SENT commandSent;
+    volatile uint32_t commandSentSeq = 0;
+    // Command of parsed response (parser task copy of sent command)
+    char responseRequest[COMMAND_REQUEST_SIZE];
+    uint64_t commandKey = 0; // COMMAND_KEY of responseRequest
+    bool responseDebug = false;
     // Menu
     bool menuVisible = false;
-    uint8_t  menuItemsCount = 78;
-    uint16_t menuCurrent = 0;
+    uint8_t  menuItemsCount = MENU_ITEMS_COUNT;
+    uint16_t menuCurrent = 0; // use setMenuCurrent()
     uint8_t  menuItemSelected = 0;
     uint8_t  menuItemOffset = 0;
     uint16_t scanningDeviceIndex = 0;
     MENU_ITEM* menuItems;
+    // Parent -> children index built once from menu.h
+    uint8_t menuChildren[MENU_ITEMS_COUNT]; // item indexes grouped by parent
+    MENU_PARENT menuParents[MENU_ITEMS_COUNT]; // sorted by parentId
+    uint8_t menuParentsCount = 0;
+    uint8_t menuChildrenFrom = 0; // children of menuCurrent
+    uint8_t menuChildrenCount = 0;
 
     // Bluetooth4
     boolean bleConnect = true;
@@ -183,12 +367,56 @@ class LiveData {
     BLEScan* pBLEScan;
     
     // Params
-    PARAMS_STRUC params;     // Realtime sensor values
+    PARAMS_STRUC params;     // Realtime sensor values (written by parser task)
+    // Params published once per poll cycle (seqlock), consistent copy for renderer/uploader
+    PARAMS_STRUC paramsPublished;
+    volatile uint32_t paramsSeq = 0;
+    volatile bool newParamsPublished = false;
+    volatile bool paramsPublishRequested = false; // queue wrapped, parser task publishes
+    // Owned by main loop
+    volatile uint32_t clockTime = 0; // seconds, copied to params.currentTime by parser task
+#ifdef SIM800L_ENABLED
+    time_t lastDataSent = 0;
+    bool sim800l_enabled = false;
+#endif //SIM800L_ENABLED
+    // Cell statistics per block, histogram bin of cell
+    CELL_BLOCK_STATS cellBlockStats[CELL_BLOCKS];
+    uint8_t cellHistogramBin[CELL_COUNT];
+    // Debug screen output (parser task -> main loop), buffers are owned by main loop while ready
+    char debugResponse[RESPONSE_MERGED_SIZE];
+    char debugRequest[COMMAND_REQUEST_SIZE];
+    volatile bool debugResponseReady = false;
     // Settings
     SETTINGS_STRUC settings, tmpSettings; // Settings stored into flash
 
     //
     void initParams();
+    void publishParams();
+    void readParams(PARAMS_STRUC &dest);
+    void publishCommand(const char* request, uint8_t length, uint64_t key, bool debug);
+    void readCommand();
+    void setCommandQueue(const char* const* commands, uint16_t count, uint16_t loopFrom);
+    void setFlowControlHeaders(const char* const* headers, uint8_t count);
+    void setMonitorIds(const uint16_t* ids, uint8_t count);
+    void addMonitorId(uint16_t id);
+    void setPeriodicDids(const PERIODIC_DID* dids, uint8_t count);
+    void setCommandStreamed(uint64_t key, bool streamed);
+    void periodicFrameReceived(uint16_t id, uint8_t periodicId);
+    void applyCommandSchedule(const COMMAND_SCHEDULE* schedule, uint16_t scheduleCount);
+    bool isCommandDue(uint16_t index, unsigned long now);
+    unsigned long nextCommandDueMs(unsigned long now);
+    void subscribeSignals(uint32_t signals);
+    void updateCellStats(uint16_t from, uint16_t count);
+    void initMenuIndex();
+    void setMenuCurrent(uint16_t parentId);
+    MENU_ITEM* menuChild(uint8_t position);
+    bool pushResponseBytes(const uint8_t* data, size_t length);
+    bool popResponseByte(uint8_t &ch);
+    void setResponseMerged(const char* hex);
+    void appendResponseMerged(const char* hex, uint16_t length);
+    void decodeResponse();
+    uint8_t hexToByte(const char* hex);
+    uint64_t makeCommandKey(const char* atshRequest, const char* commandRequest);
     float hexToDec(String hexString, byte bytes = 2, bool signedNum = true);
     float km2distance(float inKm);
     float celsius2temperature(float inCelsius);
@@ -45,6 +45,61 @@
 #define TFT_GRAPH_OPTIMAL25  0x0200
 #define TFT_GRAPH_RAPIDGATE35 0x8300
 
+////////////////////////////////////////////////////////////
+// OBD PARSER TASK
+/////////////////////////////////////////////////////////////
+
+#define PARSER_TASK_CORE 0        // loop() runs on core 1
+#define PARSER_TASK_PRIORITY 2    // above loop() (1)
+#define PARSER_TASK_STACK 8192
+
+////////////////////////////////////////////////////////////
+// FRAME SCHEDULER
+/////////////////////////////////////////////////////////////
+
+#define FRAME_TARGET_FPS 10       // max. screen refresh rate
+#define FRAME_BUDGET_MS 40        // slower frame delays next frame by overrun
+
+////////////////////////////////////////////////////////////
+// COMMAND WATCHDOG
+/////////////////////////////////////////////////////////////
+
+#define COMMAND_TIMEOUT_MS 1000       // no prompt (>) until deadline - command is retried or skipped
+#define COMMAND_INIT_TIMEOUT_MS 5000  // init AT commands (AT Z resets adapter)
+#define COMMAND_RETRIES 1             // resend count before command is skipped
+#define COMMAND_IDLE_MAX_MS 1000      // queue without due command is scanned again at least this often
+
+////////////////////////////////////////////////////////////
+// ISO-TP FLOW CONTROL
+/////////////////////////////////////////////////////////////
+
+#ifndef FLOW_CONTROL_FAST
+#define FLOW_CONTROL_FAST 0           // 1 - block size 0, STmin 0 for ECU headers listed by car (0 - adapter default)
+#endif
+#define FLOW_CONTROL_HEADERS_MAX 8
+
+////////////////////////////////////////////////////////////
+// CAN MONITOR MODE
+/////////////////////////////////////////////////////////////
+
+// ATMA burst after each poll loop for broadcast ids registered by car (setMonitorIds)
+#define MONITOR_WINDOW_MS 200         // receive window of one burst
+#define MONITOR_BACKOFF_MS 5000       // pause after failed burst (BUFFER FULL, timeout), doubled by each next failure
+#define MONITOR_BACKOFF_STEPS 6       // max. 5 s << 5 = 160 s
+#define MONITOR_STOP_RETRIES 2        // bare \r after lost prompt of ATMA (second one stops ATMA repeated by first)
+#define MONITOR_IDS_MAX 8
+
+////////////////////////////////////////////////////////////
+// UDS PERIODIC DATA (0x2A)
+/////////////////////////////////////////////////////////////
+
+#ifndef PERIODIC_MODE
+#define PERIODIC_MODE 0               // 1 - subscribe periodic DIDs listed by car (frames received in monitor bursts), experimental - no car lists verified DIDs
+#endif
+#define PERIODIC_RATE "03"            // transmission mode 01 slow, 02 medium, 03 fast
+#define PERIODIC_STALE_MS 5000        // no frame of active DID - polling again
+#define PERIODIC_DIDS_MAX 8
+
 ////////////////////////////////////////////////////////////
 // SIM800L
 /////////////////////////////////////////////////////////////
@@ -57,13 +112,23 @@
 #endif //SIM800L_ENABLED
 
 // MENU ITEM
+#define MENU_ITEMS_COUNT 78
+#define MENU_CAPTION_SIZE 64
+
 typedef struct {
   int16_t id;
   int16_t parentId;
   int16_t targetParentId;
   char title[50];
-  char obdMacAddress[20];
-  char serviceUUID[40];
+  char obdMacAddress[20] = "";
+  char serviceUUID[40] = "";
 } MENU_ITEM;
 
+// Children of one menu (menuChildren[from..from+count-1])
+typedef struct {
+  int16_t parentId;
+  uint8_t from;
+  uint8_t count;
+} MENU_PARENT;
+
 #endif // CONFIG_H
@@ -46,6 +46,8 @@
 #endif
 
 #include <sys/time.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 #include "config.h"
 #include "LiveData.h"
 #include "CarInterface.h"
@@ -73,52 +75,367 @@ BoardInterface* board;
 CarInterface* car;
 LiveData* liveData;
 
+// Parses responses received by BLE callback
+TaskHandle_t parserTaskHandle = NULL;
+
+// Frame scheduler
+unsigned long nextFrameMs = 0;
+
 /**
-  Do next AT command from queue
+  Write new command to adapter (ends with \r), deadline of its prompt is armed, command is kept for resend
 */
-bool doNextAtCommand() {
+void writeCommand(const char* command, uint8_t length, unsigned long now, unsigned long timeoutMs) {
+
+  if (length > COMMAND_REQUEST_SIZE)
+    length = COMMAND_REQUEST_SIZE;
+  memcpy(liveData->commandInFlight, command, length);
+  liveData->commandInFlightLength = length;
+  liveData->commandInFlightTimeoutMs = timeoutMs;
+  // Late prompt of skipped command may still come, it does not release this one
+  __atomic_fetch_add(&liveData->commandPromptsPending, 1, __ATOMIC_ACQ_REL);
+  liveData->commandRetry = 0;
+  liveData->commandQueueIdleMs = 0;
+  liveData->commandSentMs = now;
+  liveData->commandDeadlineMs = now + timeoutMs;
+  liveData->pRemoteCharacteristicWrite->writeValue((uint8_t*)command, length);
+}
+
+/**
+  Resend command without prompt, prompt of previous write may still come (stale, ignored)
+*/
+void resendCommand(unsigned long now) {
+
+  __atomic_fetch_add(&liveData->commandPromptsPending, 1, __ATOMIC_ACQ_REL);
+  liveData->commandSentMs = now;
+  liveData->commandDeadlineMs = now + liveData->commandInFlightTimeoutMs;
+  liveData->pRemoteCharacteristicWrite->writeValue((uint8_t*)liveData->commandInFlight, liveData->commandInFlightLength);
+}
 
-  // Restart loop with AT commands
-  if (liveData->commandQueueIndex >= liveData->commandQueueCount) {
-    liveData->commandQueueIndex = liveData->commandQueueLoopFrom;
-    board->redrawScreen();
+/**
+  Send command of queue, deadline of prompt is armed
+*/
+void sendAtCommand(uint16_t index, unsigned long now) {
+
+  // Send AT command to obd (table entry already ends with \r)
+  const char* command = liveData->commandQueue[index];
+  uint8_t length = liveData->commandQueueLength[index];
+  char request[COMMAND_REQUEST_SIZE];
+  strlcpy(request, command, (length + 1 < COMMAND_REQUEST_SIZE) ? length + 1 : COMMAND_REQUEST_SIZE);
+  liveData->commandRequest = request;
+  // Parser task reads only this copy, response of queue index + 1 (index after send) goes to debug screen
+  liveData->publishCommand(command, length, liveData->commandQueueKey[index], board->displayScreen == SCREEN_DEBUG && board->debugCommandIndex == index + 1);
+  if (strncmp(request, "ATSH", 4) == 0) {
+    liveData->currentAtshRequest = request;
   }
 
-  // Send AT command to obd
-  liveData->commandRequest = liveData->commandQueue[liveData->commandQueueIndex];
-  if (liveData->commandRequest.startsWith("ATSH")) {
-    liveData->currentAtshRequest = liveData->commandRequest;
+  // Header of adapter (AT Z, AT D reset it and flow control)
+  if (strncmp(request, "ATSH", 4) == 0) {
+    liveData->adapterAtsh = command;
+    liveData->atshSwitches++;
+    liveData->flowControlHeader = -1;
+    for (uint8_t i = 0; i < liveData->flowControlHeadersCount; i++) {
+      if (strncmp(liveData->flowControlHeaders[i], command, length + 1) == 0) {
+        liveData->flowControlHeader = i;
+        break;
+      }
+    }
+  } else if (index < liveData->commandQueueLoopFrom) {
+    liveData->adapterAtsh = NULL;
+    liveData->flowControlHeader = -1;
+    liveData->flowControlMode = 0;
+    liveData->flowControlData = false;
   }
 
   Serial.print(">>> ");
-  Serial.println(liveData->commandRequest);
-  String tmpStr = liveData->commandRequest + "\r";
-  liveData->pRemoteCharacteristicWrite->writeValue(tmpStr.c_str(), tmpStr.length());
-  liveData->commandQueueIndex++;
+  Serial.println(request);
+  writeCommand(command, length + 1, now, (index < liveData->commandQueueLoopFrom) ? COMMAND_INIT_TIMEOUT_MS : COMMAND_TIMEOUT_MS);
+}
+
+/**
+  Send adapter setting command outside of queue (ends with \r, no response decoding)
+*/
+void sendAdapterCommand(const char* command, unsigned long timeoutMs) {
+
+  unsigned long now = millis();
+  char request[COMMAND_REQUEST_SIZE];
+  uint8_t length;
+
+  // Request for debug screen without \r
+  strlcpy(request, command, sizeof(request));
+  length = strlen(request);
+  if (length > 0 && request[length - 1] == '\r')
+    request[--length] = '\0';
+  liveData->commandRequest = request;
+  liveData->publishCommand(request, length, 0, false);
+  Serial.print(">>> ");
+  Serial.println(request);
+  writeCommand(command, strlen(command), now, timeoutMs);
+}
+
+/**
+  Switch adapter flow control for active ECU header (fast - user data 30 00 00 with automatic header)
+  Returns true if command was sent (next queue command waits for prompt)
+*/
+bool sendFlowControl() {
+
+  if (!FLOW_CONTROL_FAST)
+    return false;
+
+  const char* command = NULL;
+  bool fast = (liveData->flowControlHeader != -1 && !liveData->flowControlDisabled[liveData->flowControlHeader]);
+
+  if (fast && !liveData->flowControlData) {
+    command = "ATFCSD300000\r";
+    liveData->flowControlData = true;
+  } else if (fast && liveData->flowControlMode != 2) {
+    command = "ATFCSM2\r";
+    liveData->flowControlMode = 2;
+  } else if (!fast && liveData->flowControlMode != 0) {
+    command = "ATFCSM0\r";
+    liveData->flowControlMode = 0;
+  }
+  if (command == NULL)
+    return false;
+
+  sendAdapterCommand(command, COMMAND_TIMEOUT_MS);
 
   return true;
 }
 
 /**
-  Parse result from OBD, create single line liveData->responseRowMerged
+  Subscribe next periodic DID (ATSH of ECU, 2A <rate> <id>), result is evaluated by parseRow
+  Returns true if command was sent (next queue command waits for prompt)
 */
-bool parseRow() {
+bool sendPeriodic() {
 
-  // Simple 1 line responses
-  Serial.print("");
-  Serial.println(liveData->responseRow);
+  char command[16];
+
+  if (!PERIODIC_MODE)
+    return false;
+
+  switch (liveData->periodicStep) {
+    case PERIODIC_STEP_IDLE:
+      for (liveData->periodicIndex = 0; liveData->periodicIndex < liveData->periodicDidsCount; liveData->periodicIndex++)
+        if (liveData->periodicState[liveData->periodicIndex] == PERIODIC_STATE_UNKNOWN)
+          break;
+      if (liveData->periodicIndex >= liveData->periodicDidsCount)
+        return false;
+      // Header outside of queue, queue ATSH must be sent again
+      sendAdapterCommand(liveData->periodicDids[liveData->periodicIndex].atshRequest, COMMAND_TIMEOUT_MS);
+      liveData->adapterAtsh = NULL;
+      liveData->flowControlHeader = -1;
+      liveData->periodicStep = PERIODIC_STEP_REQUEST;
+      return true;
+    case PERIODIC_STEP_REQUEST:
+      sprintf(command, "2A%s%02X\r", PERIODIC_RATE, liveData->periodicDids[liveData->periodicIndex].periodicId);
+      liveData->periodicState[liveData->periodicIndex] = PERIODIC_STATE_PENDING;
+      liveData->periodicStep = PERIODIC_STEP_RESULT;
+      sendAdapterCommand(command, COMMAND_TIMEOUT_MS);
+      return true;
+    default:
+      // No positive response (6A), keep polling
+      if (liveData->periodicState[liveData->periodicIndex] == PERIODIC_STATE_PENDING) {
+        liveData->periodicState[liveData->periodicIndex] = PERIODIC_STATE_REJECTED;
+        liveData->periodicFallbacks++;
+      }
+      liveData->periodicStep = PERIODIC_STEP_IDLE;
+      return false;
+  }
+}
+
+/**
+  Active periodic DID without frames - polling again
+*/
+void checkPeriodicStale(unsigned long now) {
+
+  for (uint8_t i = 0; i < liveData->periodicDidsCount; i++) {
+    if (liveData->periodicState[i] == PERIODIC_STATE_ACTIVE && now - liveData->periodicLastFrameMs[i] > PERIODIC_STALE_MS) {
+      liveData->periodicState[i] = PERIODIC_STATE_REJECTED;
+      liveData->setCommandStreamed(liveData->periodicDids[i].pollKey, false);
+      liveData->periodicFallbacks++;
+    }
+  }
+}
+
+/**
+  Next step of monitor burst (raw frames of one broadcast id for MONITOR_WINDOW_MS)
+  Returns true if command was sent (next queue command waits for prompt)
+*/
+bool sendMonitor() {
+
+  char command[16];
+  unsigned long timeoutMs = COMMAND_TIMEOUT_MS;
+
+  switch (liveData->monitorStep) {
+    case MONITOR_STEP_IDLE:
+      return false;
+    case MONITOR_STEP_CAF_OFF:
+      strcpy(command, "ATCAF0\r");
+      liveData->monitorOverrun = false;
+      liveData->monitorStops = 0;
+      break;
+    case MONITOR_STEP_FILTER:
+      sprintf(command, "ATCRA%03X\r", liveData->monitorIds[liveData->monitorIdIndex]);
+      break;
+    case MONITOR_STEP_MONITOR:
+      strcpy(command, "ATMA\r");
+      liveData->monitorEndMs = millis() + MONITOR_WINDOW_MS;
+      liveData->monitorActive = true;
+      timeoutMs += MONITOR_WINDOW_MS;
+      break;
+    case MONITOR_STEP_RESTORE:
+      strcpy(command, "ATAR\r");
+      break;
+    default:
+      strcpy(command, "ATCAF1\r");
+      liveData->monitorIdIndex = (liveData->monitorIdIndex + 1) % liveData->monitorIdsCount;
+      // Failed burst is retried after backoff, doubled by each next failure
+      if (liveData->monitorOverrun) {
+        if (liveData->monitorFailures < MONITOR_BACKOFF_STEPS)
+          liveData->monitorFailures++;
+        liveData->monitorRetryMs = millis() + ((unsigned long)MONITOR_BACKOFF_MS << (liveData->monitorFailures - 1));
+      } else {
+        liveData->monitorFailures = 0;
+      }
+      break;
+  }
+  liveData->monitorStep = (liveData->monitorStep >= MONITOR_STEP_CAF_ON) ? MONITOR_STEP_IDLE : liveData->monitorStep + 1;
+
+  sendAdapterCommand(command, timeoutMs);
+
+  return true;
+}
+
+/**
+  ATSH command of queue is already active in adapter (redundant write)
+*/
+bool isAtshActive(uint16_t index) {
+
+  const char* command = liveData->commandQueue[index];
+  uint8_t length = liveData->commandQueueLength[index];
+
+  if (liveData->adapterAtsh == NULL || strncmp(command, "ATSH", 4) != 0)
+    return false;
+  if (liveData->adapterAtsh != command && (strncmp(liveData->adapterAtsh, command, length) != 0 || liveData->adapterAtsh[length] != '\r'))
+    return false;
+
+  liveData->atshElided++;
+  return true;
+}
+
+/**
+  Do next AT command from queue
+  Without due command nothing is sent, queue idles until earliest refresh (main loop scans it again)
+*/
+bool doNextAtCommand() {
+
+  unsigned long now = millis();
+
+  // Output for debug screen, response of previous command is parsed
+  if (__atomic_load_n(&liveData->debugResponseReady, __ATOMIC_ACQUIRE)) {
+    board->debugAtshRequest = liveData->currentAtshRequest;
+    board->debugCommandRequest = liveData->debugRequest;
+    board->debugLastString = liveData->debugResponse;
+    __atomic_store_n(&liveData->debugResponseReady, false, __ATOMIC_RELEASE);
+  }
 
-  // Merge 0:xxxx 1:yyyy 2:zzzz to single xxxxyyyyzzzz string
-  if (liveData->responseRow.length() >= 2 && liveData->responseRow.charAt(1) == ':') {
-    if (liveData->responseRow.charAt(0) == '0') {
-      liveData->responseRowMerged = "";
+  // Skip commands with refresh rate not elapsed yet (slow values), hot values are requested every loop
+  // Queue is grouped by ECU header, ATSH of group without due command is skipped as well
+  uint16_t startIndex = liveData->commandQueueIndex;
+  for (uint16_t skipped = 0; ; skipped++) {
+    // Restart loop with AT commands
+    if (liveData->commandQueueIndex >= liveData->commandQueueCount) {
+      liveData->commandQueueIndex = liveData->commandQueueLoopFrom;
+      liveData->atshSwitchesLastLoop = liveData->atshSwitches;
+      liveData->atshSwitches = 0;
+      // All responses of cycle are parsed (prompt or skip), values of one cycle are published together
+      __atomic_store_n(&liveData->paramsPublishRequested, true, __ATOMIC_RELEASE);
+      if (parserTaskHandle != NULL)
+        xTaskNotifyGive(parserTaskHandle);
+      // Broadcast frames between poll loops
+      if (liveData->monitorIdsCount > 0 && liveData->monitorStep == MONITOR_STEP_IDLE && (long)(now - liveData->monitorRetryMs) >= 0)
+        liveData->monitorStep = MONITOR_STEP_CAF_OFF;
+    }
+    if (skipped > liveData->commandQueueCount) {
+      // Scan continues from same position (header of adapter), monitor burst of wrapped queue starts now
+      liveData->commandQueueIndex = startIndex;
+      liveData->commandDeadlineMs = 0;
+      liveData->commandQueueIdleMs = (liveData->monitorStep != MONITOR_STEP_IDLE) ? now : liveData->nextCommandDueMs(now);
+      liveData->commandQueueIdles++;
+      return false;
     }
-    liveData->responseRowMerged += liveData->responseRow.substring(2);
+    if (liveData->isCommandDue(liveData->commandQueueIndex, now) && !isAtshActive(liveData->commandQueueIndex))
+      break;
+    liveData->commandQueueIndex++;
   }
+  liveData->commandQueueLastSentMs[liveData->commandQueueIndex] = now;
+
+  sendAtCommand(liveData->commandQueueIndex, now);
+  liveData->commandQueueIndex++;
 
   return true;
 }
 
+/**
+  Prompt of sent command not received until deadline (lost notification, adapter hang)
+  Command is resent COMMAND_RETRIES times, then skipped and queue continues
+*/
+void commandTimeout(unsigned long now) {
+
+  liveData->commandTimeouts++;
+  liveData->commandStallMs = now - liveData->commandSentMs;
+  // Only prompt of last write can still come late, older ones are lost (no stale count growing forever)
+  uint32_t pending = __atomic_load_n(&liveData->commandPromptsPending, __ATOMIC_ACQUIRE);
+  while (pending > 1 && !__atomic_compare_exchange_n(&liveData->commandPromptsPending, &pending, 1, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+    ;
+  liveData->flowControlMode = FLOW_CONTROL_UNKNOWN;
+  liveData->flowControlData = false;
+
+  // Periodic DID subscription without answer is evaluated as rejected
+  if (liveData->periodicStep != PERIODIC_STEP_IDLE) {
+    liveData->periodicState[liveData->periodicIndex] = PERIODIC_STATE_PENDING;
+    liveData->periodicStep = PERIODIC_STEP_RESULT;
+    sendPeriodic();
+    doNextAtCommand();
+    return;
+  }
+
+  // Monitor burst failed, restore receive filter and CAF (next burst after backoff)
+  if (liveData->monitorStep != MONITOR_STEP_IDLE) {
+    liveData->monitorActive = false;
+    liveData->monitorOverrun = true;
+    // ATMA may still run (stop at window end lost), first byte of ATAR would only abort it
+    // Bare \r stops it (prompt of ATMA follows), if ATMA already stopped (prompt lost) \r repeats it and next \r stops it
+    if (liveData->monitorStep == MONITOR_STEP_RESTORE && liveData->monitorStops < MONITOR_STOP_RETRIES) {
+      liveData->monitorStops++;
+      liveData->commandSentMs = now;
+      liveData->commandDeadlineMs = now + COMMAND_TIMEOUT_MS;
+      liveData->pRemoteCharacteristicWrite->writeValue((uint8_t*)"\r", 1);
+      return;
+    }
+    if (liveData->monitorStep < MONITOR_STEP_RESTORE)
+      liveData->monitorStep = MONITOR_STEP_RESTORE;
+    sendMonitor();
+    return;
+  }
+  Serial.print("Command timeout ");
+  Serial.println(liveData->commandRequest);
+
+  // Last written command (queue or adapter setting)
+  if (liveData->commandRetry < COMMAND_RETRIES) {
+    liveData->commandRetry++;
+    liveData->commandRetries++;
+    resendCommand(now);
+    return;
+  }
+
+  // Header of skipped ATSH is unknown
+  liveData->commandSkips++;
+  if (strncmp(liveData->commandRequest.c_str(), "ATSH", 4) == 0)
+    liveData->adapterAtsh = NULL;
+  doNextAtCommand();
+}
+
 /**
   Parse merged row (after merge completed)
 */
@@ -127,17 +444,98 @@ bool parseRowMerged() {
   Serial.print("merged:");
   Serial.println(liveData->responseRowMerged);
 
-  // Catch output for debug screen
-  if (board->displayScreen == SCREEN_DEBUG) {
-    if (board->debugCommandIndex == liveData->commandQueueIndex) {
-      board->debugAtshRequest = liveData->currentAtshRequest;
-      board->debugCommandRequest = liveData->commandRequest;
-      board->debugLastString  = liveData->responseRowMerged;
+  // Command of response, fixed at send time (main loop may already send next one)
+  liveData->readCommand();
+
+  // Catch output for debug screen (passed to board by main loop)
+  if (liveData->responseDebug && !__atomic_load_n(&liveData->debugResponseReady, __ATOMIC_ACQUIRE)) {
+    strlcpy(liveData->debugResponse, liveData->responseRowMerged, RESPONSE_MERGED_SIZE);
+    strlcpy(liveData->debugRequest, liveData->responseRequest, COMMAND_REQUEST_SIZE);
+    __atomic_store_n(&liveData->debugResponseReady, true, __ATOMIC_RELEASE);
+  }
+
+  // Decode and parse by selected car interface, values are published at end of poll cycle
+  car->parseMergedResponse();
+
+  return true;
+}
+
+/**
+  Parse result from OBD, create single line liveData->responseRowMerged
+*/
+bool parseRow() {
+
+  // Monitor mode, each row is one frame of filtered id
+  if (liveData->monitorActive || liveData->monitorStep == MONITOR_STEP_RESTORE) {
+    if (strcmp(liveData->responseRow, "BUFFER FULL") == 0) {
+      // Adapter can't keep up, fall back to polling
+      liveData->monitorOverrun = true;
+      return true;
+    }
+    bool frame = (liveData->responseRowLength >= 2 && liveData->responseRowLength <= 16);
+    for (uint16_t i = 0; frame && i < liveData->responseRowLength; i++)
+      frame = isxdigit(liveData->responseRow[i]);
+    if (frame) {
+      liveData->setResponseMerged(liveData->responseRow);
+      car->parseMonitorFrame(liveData->monitorIds[liveData->monitorIdIndex]);
+      liveData->periodicFrameReceived(liveData->monitorIds[liveData->monitorIdIndex], liveData->responsePayload[0]);
+      liveData->setResponseMerged("");
+      liveData->monitorFrames++;
     }
+    return true;
   }
 
-  // Parse by selected car interface
-  car->parseRowMerged();
+  // Simple 1 line responses
+  Serial.print("");
+  Serial.println(liveData->responseRow);
+
+  // Result of periodic DID subscription, negative response 7F 2A keeps polling
+  if (liveData->periodicStep == PERIODIC_STEP_RESULT && liveData->periodicState[liveData->periodicIndex] == PERIODIC_STATE_PENDING) {
+    if (strncmp(liveData->responseRow, "6A", 2) == 0) {
+      liveData->periodicState[liveData->periodicIndex] = PERIODIC_STATE_ACTIVE;
+      liveData->periodicLastFrameMs[liveData->periodicIndex] = millis();
+      liveData->setCommandStreamed(liveData->periodicDids[liveData->periodicIndex].pollKey, true);
+    } else if (strncmp(liveData->responseRow, "7F2A", 4) == 0) {
+      liveData->periodicState[liveData->periodicIndex] = PERIODIC_STATE_REJECTED;
+      liveData->periodicFallbacks++;
+    }
+    return true;
+  }
+
+  // Frames of other message on same id (periodic DID) during merge or after complete response are dropped by sequence
+  bool merging = (liveData->responseRowMergedLength > 0 && !liveData->responseCompleted);
+
+  // Byte count of multi frame response precedes 0: line
+  if (liveData->responseRowLength == 3 && isxdigit(liveData->responseRow[0]) && isxdigit(liveData->responseRow[1]) && isxdigit(liveData->responseRow[2])) {
+    if (merging || liveData->responseCompleted) {
+      liveData->responseFramesDropped++;
+      return true;
+    }
+    liveData->responseExpectedLength = strtol(liveData->responseRow, NULL, 16);
+    liveData->responseCompleted = false;
+    return true;
+  }
+
+  // Merge 0:xxxx 1:yyyy 2:zzzz to single xxxxyyyyzzzz string, sequence wraps F -> 0
+  if (liveData->responseRowLength >= 2 && liveData->responseRow[1] == ':' && isxdigit(liveData->responseRow[0])) {
+    uint8_t frame = liveData->hexToByte(liveData->responseRow) >> 4; // high nibble (':' is 0)
+    if (liveData->responseCompleted || frame != (merging ? liveData->responseNextFrame : 0)) {
+      liveData->responseFramesDropped++;
+      return true;
+    }
+    if (!merging)
+      liveData->responseRowMergedLength = 0;
+    liveData->responseNextFrame = (frame + 1) & 0x0F;
+    liveData->appendResponseMerged(liveData->responseRow + 2, liveData->responseRowLength - 2);
+    // Last frame received, decode now (prompt comes after adapter timeout)
+    if (!liveData->responseCompleted && liveData->responseExpectedLength != 0 &&
+        liveData->responseRowMergedLength / 2 >= liveData->responseExpectedLength) {
+      liveData->responseCompleted = true;
+      liveData->responseCompletedMs = millis();
+      liveData->responseEarlyCompleted++;
+      parseRowMerged();
+    }
+  }
 
   return true;
 }
@@ -252,26 +650,76 @@ class MySecurity : public BLESecurityCallbacks {
 */
 static void notifyCallback (BLERemoteCharacteristic * pBLERemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify) {
 
-  char ch;
+  // Only store bytes and wake up parser, BLE task never waits for decode
+  liveData->pushResponseBytes(pData, length);
+  if (parserTaskHandle != NULL)
+    xTaskNotifyGive(parserTaskHandle);
+}
+
+/**
+  Parse received bytes to single lines and merged response
+*/
+void processResponse() {
+
+  uint8_t ch;
 
-  // Parse multi line response to single lines
-  liveData->responseRow = "";
-  for (int i = 0; i <= length; i++) {
-    ch = pData[i];
-    if (ch == '\r'  || ch == '\n' || ch == '\0') {
-      if (liveData->responseRow != "")
+  for (;;) {
+    // Poll cycle completed, next command was written after request (its bytes follow)
+    if (__atomic_load_n(&liveData->paramsPublishRequested, __ATOMIC_ACQUIRE)) {
+      __atomic_store_n(&liveData->paramsPublishRequested, false, __ATOMIC_RELAXED);
+      liveData->publishParams();
+    }
+    if (!liveData->popResponseByte(ch))
+      break;
+    if (ch == '\r' || ch == '\n' || ch == '\0') {
+      if (liveData->responseRowLength > 0)
         parseRow();
-      liveData->responseRow = "";
-    } else {
-      liveData->responseRow += ch;
-      if (liveData->responseRow == ">") {
-        if (liveData->responseRowMerged != "") {
-          parseRowMerged();
+      liveData->responseRowLength = 0;
+      liveData->responseRow[0] = '\0';
+      continue;
+    }
+    // Prompt, adapter is ready for next command (complete multi frame response is already parsed)
+    if (ch == '>' && liveData->responseRowLength == 0) {
+      if (liveData->responseCompleted) {
+        liveData->promptLatencyMs = millis() - liveData->responseCompletedMs;
+      } else if (liveData->responseRowMergedLength > 0) {
+        // Truncated multi frame response with fast flow control, ECU falls back to default
+        if (liveData->responseExpectedLength != 0 && liveData->flowControlMode == 2 && liveData->flowControlHeader != -1) {
+          liveData->flowControlDisabled[liveData->flowControlHeader] = true;
+          liveData->flowControlFallbacks++;
         }
-        liveData->responseRowMerged = "";
-        liveData->canSendNextAtCommand = true;
+        parseRowMerged();
+      }
+      liveData->setResponseMerged("");
+      liveData->responseExpectedLength = 0;
+      liveData->responseCompleted = false;
+      liveData->monitorActive = false;
+      // Late prompt of earlier write (resent or skipped command), next command waits for prompt of last write
+      uint32_t pending = __atomic_load_n(&liveData->commandPromptsPending, __ATOMIC_ACQUIRE);
+      while (!__atomic_compare_exchange_n(&liveData->commandPromptsPending, &pending, (pending > 1) ? pending - 1 : 0, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        ;
+      if (pending > 1) {
+        liveData->commandStalePrompts++;
+        continue;
       }
+      liveData->canSendNextAtCommand = true;
+      continue;
     }
+    if (liveData->responseRowLength < RESPONSE_ROW_SIZE - 1) {
+      liveData->responseRow[liveData->responseRowLength++] = ch;
+      liveData->responseRow[liveData->responseRowLength] = '\0';
+    }
+  }
+}
+
+/**
+  Parser task
+*/
+void parserTask(void* parameter) {
+
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
+    processResponse();
   }
 }
 
@@ -385,7 +833,7 @@ void startBleScan() {
   if (liveData->menuItemSelected == 2) {
     Serial.println("Display menu with devices");
     liveData->menuVisible = true;
-    liveData->menuCurrent = 9999;
+    liveData->setMenuCurrent(9999);
     liveData->menuItemSelected = 0;
     board->showMenu();
   } else {
@@ -431,7 +879,8 @@ bool sim800lSetup() {
     }
 
     if(sim800l_gprs) {
-      liveData->params.sim800l_enabled = true;
+      liveData->sim800l_enabled = true;
+      liveData->backgroundSignals |= SIGNAL_SOC | SIGNAL_BATTERY; // values sent via GPRS
       Serial.println("GPRS OK");
     } else {
       Serial.println("Problem to set GPRS");
@@ -467,20 +916,22 @@ bool sendDataViaGPRS() {
   Serial.println("Start HTTP POST...");
 
   StaticJsonDocument<250> jsonData;
+  static PARAMS_STRUC params;
 
+  liveData->readParams(params);
   jsonData["akey"] = liveData->settings.remoteApiKey;
-  jsonData["soc"] = liveData->params.socPerc;
-  jsonData["soh"] = liveData->params.sohPerc;
-  jsonData["batK"] = liveData->params.batPowerKw;
-  jsonData["batA"] = liveData->params.batPowerAmp;
-  jsonData["batV"] = liveData->params.batVoltage;
-  jsonData["auxV"] = liveData->params.auxVoltage;
-  jsonData["MinC"] = liveData->params.batMinC;
-  jsonData["MaxC"] = liveData->params.batMaxC;
-  jsonData["InlC"] = liveData->params.batInletC;
-  jsonData["fan"] = liveData->params.batFanStatus;
-  jsonData["cumCh"] = liveData->params.cumulativeEnergyChargedKWh;
-  jsonData["cumD"] = liveData->params.cumulativeEnergyDischargedKWh;
+  jsonData["soc"] = params.socPerc;
+  jsonData["soh"] = params.sohPerc;
+  jsonData["batK"] = params.batPowerKw;
+  jsonData["batA"] = params.batPowerAmp;
+  jsonData["batV"] = params.batVoltage;
+  jsonData["auxV"] = params.auxVoltage;
+  jsonData["MinC"] = params.batMinC;
+  jsonData["MaxC"] = params.batMaxC;
+  jsonData["InlC"] = params.batInletC;
+  jsonData["fan"] = params.batFanStatus;
+  jsonData["cumCh"] = params.cumulativeEnergyChargedKWh;
+  jsonData["cumD"] = params.cumulativeEnergyDischargedKWh;
 
   char payload[200];
   serializeJson(jsonData, payload);
@@ -554,7 +1005,7 @@ void setup(void) {
   settimeofday(&tv, NULL);
   struct tm now;
   getLocalTime(&now, 0);
-  liveData->params.chargingStartTime = liveData->params.currentTime = mktime(&now);
+  liveData->clockTime = mktime(&now);
 
   // Hold right button
   board->afterSetup();
@@ -566,7 +1017,7 @@ void setup(void) {
     } else {
     Serial.println("SDCARD initialization done.");
     }
-    /*spiSD.begin(SD_SCLK,SD_MISO,SD_MOSI,SD_CS);
+    spiSD.begin(SD_SCLK,SD_MISO,SD_MOSI,SD_CS);
     if(!SD.begin( SD_CS, spiSD, 27000000)){
     Serial.println("SDCARD initialization failed!");
     } else {
@@ -574,6 +1025,9 @@ void setup(void) {
     }*/
   #endif
 
+  // Parser task (responses from BLE callback)
+  xTaskCreatePinnedToCore(parserTask, "parser", PARSER_TASK_STACK, NULL, PARSER_TASK_PRIORITY, &parserTaskHandle, PARSER_TASK_CORE);
+
   // Start BLE connection
   line = "";
   Serial.println("Start BLE with PIN auth");
@@ -638,28 +1092,53 @@ void loop() {
       }
     }
 
-    // Can send next command from queue to OBD
+    // Can send next command from queue to OBD, deadline drives send if prompt was lost
     if (liveData->canSendNextAtCommand) {
       liveData->canSendNextAtCommand = false;
-      doNextAtCommand();
+      checkPeriodicStale(millis());
+      if (!sendPeriodic() && !sendMonitor() && !sendFlowControl())
+        doNextAtCommand();
+    } else if (liveData->monitorActive && (long)(millis() - liveData->monitorEndMs) >= 0) {
+      // End of monitor window, any character stops ATMA (prompt follows)
+      liveData->monitorActive = false;
+      liveData->pRemoteCharacteristicWrite->writeValue((uint8_t*)"\r", 1);
+    } else if (liveData->commandDeadlineMs != 0 && (long)(millis() - liveData->commandDeadlineMs) >= 0) {
+      commandTimeout(millis());
+    } else if (liveData->commandQueueIdleMs != 0 && (long)(millis() - liveData->commandQueueIdleMs) >= 0) {
+      // Idle queue, earliest command is due
+      liveData->commandQueueIdleMs = 0;
+      liveData->canSendNextAtCommand = true;
+    }
+  }
+
+  // Frame scheduler, latest published values are rendered at target fps independently of command queue
+  // Pending OBD command has priority, new values are coalesced into next frame
+  if (liveData->newParamsPublished && !liveData->canSendNextAtCommand) {
+    unsigned long frameStartMs = millis();
+    if ((long)(frameStartMs - nextFrameMs) >= 0) {
+      liveData->newParamsPublished = false;
+      board->redrawScreen();
+      // Frame over budget skips next frames by overrun
+      unsigned long frameMs = millis() - frameStartMs;
+      nextFrameMs = frameStartMs + (1000 / FRAME_TARGET_FPS) + ((frameMs > FRAME_BUDGET_MS) ? frameMs - FRAME_BUDGET_MS : 0);
     }
   }
 
 #ifdef SIM800L_ENABLED
-  if(liveData->params.lastDataSent + SIM800L_TIMER < liveData->params.currentTime && liveData->params.sim800l_enabled) {
+  if(liveData->lastDataSent + SIM800L_TIMER < liveData->clockTime && liveData->sim800l_enabled) {
     sendDataViaGPRS();
-    liveData->params.lastDataSent = liveData->params.currentTime;
+    liveData->lastDataSent = liveData->clockTime;
   }
 #endif // SIM800L_ENABLED
 
   board->mainLoop();
 
-  // currentTime & 1ms delay
+  // currentTime (taken by parser task) & 1ms delay
   struct tm now;
   getLocalTime(&now, 0);
-  liveData->params.currentTime = mktime(&now);
-  // Shutdown when car is off
-  if (liveData->params.automaticShutdownTimer != 0 && liveData->params.currentTime - liveData->params.automaticShutdownTimer > 5)
+  __atomic_store_n(&liveData->clockTime, (uint32_t)mktime(&now), __ATOMIC_RELAXED);
+  // Shutdown when car is off (published params of last frame)
+  if (board->params.automaticShutdownTimer != 0 && (time_t)liveData->clockTime - board->params.automaticShutdownTimer > 5)
     board->shutdownDevice();
   if (board->scanDevices) {
     board->scanDevices = false;
@@ -1,8 +1,8 @@
 
 
-#include "config.h";
+#include "config.h"
 
-MENU_ITEM menuItemsSource[78] = {
+MENU_ITEM menuItemsSource[MENU_ITEMS_COUNT] = {
 
   {0, 0, 0, "<- exit menu"},
   {1, 0, -1, "Vehicle type"},
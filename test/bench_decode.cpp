@@ -0,0 +1,120 @@
+// Response decode - legacy substring/hexToDec formulas vs byte offset signal tables, loadTestData responses of each car
+// Built with COW std::string (no small string buffer), String allocates like Arduino String on ESP32
+
+#include <Arduino.h>
+#include <chrono>
+#include <new>
+#include <vector>
+#include "../LiveData.h"
+#include "../CarInterface.h"
+#include "../CarKiaEniro.h"
+#include "../CarHyundaiIoniq.h"
+#include "../CarKiaDebugObd2.h"
+#include "legacy_rows.h"
+
+#define BENCH_LOOPS 20000
+
+static uint32_t allocations = 0;
+
+// Not inlined, free of pointer from operator new is not reported as mismatched
+__attribute__((noinline)) void* operator new(size_t size) {
+
+  allocations++;
+  void* p = malloc(size ? size : 1);
+  if (p == NULL)
+    throw std::bad_alloc();
+  return p;
+}
+
+__attribute__((noinline)) void operator delete(void* p) noexcept { free(p); }
+__attribute__((noinline)) void operator delete(void* p, size_t) noexcept { free(p); }
+
+// Response of loadTestData
+typedef struct {
+  String atsh;
+  String command;
+  String merged;
+  uint64_t key;
+} CAPTURED_RESPONSE;
+
+/**
+  Car recording loadTestData responses
+*/
+template <class Car> class CapturingCar : public Car {
+  public:
+    std::vector<CAPTURED_RESPONSE> responses;
+
+    void parseRowMerged() override {
+
+      this->responses.push_back({this->liveData->currentAtshRequest, this->liveData->commandRequest,
+                                 this->liveData->responseRowMerged, this->liveData->commandKey});
+    }
+};
+
+/**
+  Both decoders over captured responses
+*/
+template <class Car> static void bench(const char* name, const LEGACY_ROW* rows, uint16_t rowsCount) {
+
+  LiveData* liveData = new LiveData();
+  liveData->initParams();
+  CapturingCar<Car>* car = new CapturingCar<Car>();
+  car->setLiveData(liveData);
+  car->activateCommandQueue();
+  car->loadTestData();
+
+  std::vector<CAPTURED_RESPONSE>& responses = car->responses;
+  uint32_t responsesCount = BENCH_LOOPS * responses.size();
+  uint8_t* params = (uint8_t*)&liveData->params;
+  uint32_t values = 0;
+
+  // Legacy, request strings compared per row, each value from substring of merged response
+  uint32_t startAllocations = allocations;
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t loop = 0; loop < BENCH_LOOPS; loop++) {
+    for (CAPTURED_RESPONSE& response : responses) {
+      for (uint16_t i = 0; i < rowsCount; i++) {
+        const LEGACY_ROW* row = &rows[i];
+        if (!response.atsh.equals(row->atsh) || !response.command.equals(row->command))
+          continue;
+        if (row->matchFrom != -1 && response.merged.substring(row->matchFrom, row->matchFrom + 2) != row->matchHex)
+          continue;
+        for (uint8_t j = 0; j < row->count; j++) {
+          uint16_t from = row->from + j * (row->to - row->from);
+          ((float*)(params + row->dest))[j] = legacyHexToDec(response.merged.substring(from, from + (row->to - row->from)), row->bytes, row->signedNum) * row->scale + row->valueOffset;
+          values++;
+        }
+      }
+    }
+  }
+  double legacyNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / responsesCount;
+  double legacyAllocations = (double)(allocations - startAllocations) / responsesCount;
+
+  // Signal table of command key, merged response decoded to bytes once
+  startAllocations = allocations;
+  start = std::chrono::steady_clock::now();
+  for (uint32_t loop = 0; loop < BENCH_LOOPS; loop++) {
+    for (CAPTURED_RESPONSE& response : responses) {
+      liveData->setResponseMerged(response.merged.c_str());
+      strlcpy(liveData->responseRequest, response.command.c_str(), COMMAND_REQUEST_SIZE);
+      liveData->commandKey = response.key;
+      liveData->decodeResponse();
+      car->decodeSignals();
+    }
+  }
+  double signalsNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / responsesCount;
+  double signalsAllocations = (double)(allocations - startAllocations) / responsesCount;
+
+  printf("%s: %u responses, %.1f legacy values/response\n", name, (unsigned)responses.size(), (double)values / responsesCount);
+  printf("  substring/hexToDec (before) %.0f ns/response, %.1f allocations/response\n", legacyNs, legacyAllocations);
+  printf("  byte offset signals (now)   %.0f ns/response, %.1f allocations/response (%.1fx)\n", signalsNs, signalsAllocations, legacyNs / signalsNs);
+}
+
+int main() {
+
+  bench<CarKiaEniro>("CarKiaEniro", legacyKiaENiro, sizeof(legacyKiaENiro) / sizeof(LEGACY_ROW));
+  bench<CarHyundaiIoniq>("CarHyundaiIoniq", legacyHyundaiIoniq, sizeof(legacyHyundaiIoniq) / sizeof(LEGACY_ROW));
+  bench<CarKiaDebugObd2>("CarKiaDebugObd2", legacyKiaDebugObd2, sizeof(legacyKiaDebugObd2) / sizeof(LEGACY_ROW));
+
+  return 0;
+}
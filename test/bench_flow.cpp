@@ -0,0 +1,192 @@
+// Poll throughput with and without fast flow control - eNiro command queue against emulated adapter and ECUs
+// ECUs answer with loadTestData responses, timing of CAN, BLE and adapter is modelled (virtual clock)
+// Values below are assumptions, bytes/s only compare both modes under the same model
+
+#include <Arduino.h>
+#include <map>
+#include "../evDash.ino"
+#include "../CarInterface.h"
+
+#define CAN_FRAME_US 250            // frame at 500 kbit/s (flow control frame, consecutive frames with STmin 0)
+#define ECU_RESPONSE_US 5000        // request to first frame
+#define BLE_BYTE_US 100             // adapter output over BLE notifications (~10 kB/s)
+#define ADAPTER_COMMAND_US 2000     // AT command to OK
+#define ADAPTER_TIMEOUT_US 30000    // last frame to prompt, request to NO DATA
+#define SIMULATION_US 60000000
+
+static BLERemoteCharacteristic adapter;
+static std::map<std::string, std::string> ecuResponses; // ATSH7E4/220101 -> merged response
+
+// Adapter state set by sent commands
+static std::string adapterHeader;
+static int adapterFcsm = 0;
+static bool adapterFcsdFast = false;
+// Virtual clock, BLE link is busy until bleFreeUs
+static uint64_t nowUs;
+static uint64_t bleFreeUs;
+static uint32_t payloadBytes;
+static uint32_t bmsResponses;
+
+/**
+  Car recording loadTestData responses of each header and command
+*/
+class CapturingCar : public CarKiaEniro {
+  public:
+    void parseRowMerged() override {
+
+      std::string key = std::string(this->liveData->currentAtshRequest.c_str()) + "/" + this->liveData->commandRequest.c_str();
+      ecuResponses[key] = this->liveData->responseRowMerged;
+    }
+};
+
+/**
+  Adapter output at time (queued behind earlier output on BLE link), parser task runs after notifications
+*/
+static void output(uint64_t atUs, const std::string& text) {
+
+  uint64_t startUs = std::max(atUs, bleFreeUs);
+
+  bleFreeUs = startUs + text.length() * BLE_BYTE_US;
+  nowUs = bleFreeUs;
+  shimMillis = nowUs / 1000;
+  for (size_t i = 0; i < text.length(); i += 20)
+    notifyCallback(NULL, (uint8_t*)text.c_str() + i, std::min((size_t)20, text.length() - i), true);
+  processResponse();
+}
+
+/**
+  Adapter and ECU answer of written command
+*/
+static void answer(std::string command, uint32_t ecuStminUs) {
+
+  command.erase(std::remove(command.begin(), command.end(), ' '), command.end());
+  command.erase(std::remove(command.begin(), command.end(), '\r'), command.end());
+  std::transform(command.begin(), command.end(), command.begin(), ::toupper);
+
+  if (command.compare(0, 2, "AT") == 0) {
+    if (command == "ATZ" || command == "ATD") {
+      adapterFcsm = 0;
+      adapterFcsdFast = false;
+    } else if (command.compare(0, 4, "ATSH") == 0) {
+      adapterHeader = command;
+    } else if (command.compare(0, 6, "ATFCSM") == 0) {
+      adapterFcsm = atoi(command.c_str() + 6);
+    } else if (command.compare(0, 6, "ATFCSD") == 0) {
+      adapterFcsdFast = (command == "ATFCSD300000");
+    }
+    output(nowUs + ADAPTER_COMMAND_US, "OK\r\r>");
+    return;
+  }
+
+  std::map<std::string, std::string>::iterator response = ecuResponses.find(adapterHeader + "/" + command);
+  if (response == ecuResponses.end()) {
+    output(nowUs + ADAPTER_TIMEOUT_US, "NO DATA\r\r>");
+    return;
+  }
+
+  // ISO-TP, first frame 6 bytes, consecutive frames 7 bytes paced by STmin of flow control (ECU own with adapter default)
+  const std::string& merged = response->second;
+  size_t length = merged.length() / 2;
+  uint64_t frameUs = nowUs + ECU_RESPONSE_US;
+  uint32_t paceUs = (adapterFcsm == 2 && adapterFcsdFast) ? CAN_FRAME_US : std::max((uint32_t)CAN_FRAME_US, ecuStminUs);
+  char line[32];
+
+  payloadBytes += length;
+  if (command == "220101")
+    bmsResponses++;
+  if (length <= 7) {
+    output(frameUs, merged + "\r");
+  } else {
+    sprintf(line, "%03X\r", (unsigned)length);
+    output(frameUs, line);
+    for (size_t from = 0, frame = 0; from < length; frame++) {
+      size_t count = (frame == 0) ? 6 : 7;
+      char* out = line + sprintf(line, "%X:", (unsigned)(frame % 16));
+      for (size_t i = 0; i < count; i++, from++)
+        out += sprintf(out, "%.2s", (from < length) ? merged.c_str() + from * 2 : "AA");
+      strcpy(out, "\r");
+      if (frame == 1)
+        frameUs += CAN_FRAME_US; // flow control frame of adapter
+      if (frame > 0)
+        frameUs += paceUs;
+      output(frameUs, line);
+    }
+  }
+  output(frameUs + ADAPTER_TIMEOUT_US, "\r>");
+}
+
+/**
+  Main loop sending commands for simulated time, returns payload bytes/s
+*/
+static double simulate(bool fast, uint32_t ecuStminUs) {
+
+  shimMillis = 1000;
+  liveData = new LiveData();
+  liveData->initParams();
+  board = new BoardTtgoT4v13();
+  board->setLiveData(liveData);
+  board->loadSettings();
+  board->initBoard();
+  car = new CarKiaEniro();
+  car->setLiveData(liveData);
+  car->activateCommandQueue();
+  board->attachCar(car);
+  liveData->pRemoteCharacteristicWrite = &adapter;
+  liveData->bleConnected = true;
+  // Without fast profile, no header is listed (adapter default flow control)
+  if (!fast)
+    liveData->flowControlHeadersCount = 0;
+
+  nowUs = bleFreeUs = (uint64_t)shimMillis * 1000;
+  adapterHeader = "";
+  adapterFcsm = 0;
+  adapterFcsdFast = false;
+  payloadBytes = bmsResponses = 0;
+  uint64_t endUs = nowUs + SIMULATION_US;
+
+  liveData->canSendNextAtCommand = true;
+  while (nowUs < endUs) {
+    shimMillis = nowUs / 1000;
+    if (liveData->canSendNextAtCommand) {
+      liveData->canSendNextAtCommand = false;
+      adapter.written.clear();
+      if (!sendPeriodic() && !sendMonitor() && !sendFlowControl())
+        doNextAtCommand();
+      if (!adapter.written.empty())
+        answer(adapter.written, ecuStminUs);
+    } else if (liveData->commandDeadlineMs != 0 && (long)(millis() - liveData->commandDeadlineMs) >= 0) {
+      commandTimeout(millis());
+    } else if (liveData->commandQueueIdleMs != 0 && (long)(millis() - liveData->commandQueueIdleMs) >= 0) {
+      liveData->commandQueueIdleMs = 0;
+      liveData->canSendNextAtCommand = true;
+    } else {
+      nowUs += 1000;
+    }
+  }
+
+  return payloadBytes * 1e6 / SIMULATION_US;
+}
+
+int main() {
+
+  static const uint32_t ecuStminUs[] = {1000, 5000, 10000};
+
+  LiveData* captureData = new LiveData();
+  captureData->initParams();
+  CapturingCar* capture = new CapturingCar();
+  capture->setLiveData(captureData);
+  capture->activateCommandQueue();
+  capture->loadTestData();
+
+  printf("eNiro queue, %u emulated responses, BLE %u us/byte, prompt %u ms after last frame\n",
+         (unsigned)ecuResponses.size(), BLE_BYTE_US, ADAPTER_TIMEOUT_US / 1000);
+  for (uint8_t i = 0; i < sizeof(ecuStminUs) / sizeof(ecuStminUs[0]); i++) {
+    double defaultRate = simulate(false, ecuStminUs[i]);
+    uint32_t defaultCycles = bmsResponses;
+    double fastRate = simulate(true, ecuStminUs[i]);
+    printf("ECU STmin %2u ms: adapter default %.0f bytes/s (%.2f BMS 220101/s), fast flow control %.0f bytes/s (%.2f/s, %.2fx)\n",
+           ecuStminUs[i] / 1000, defaultRate, defaultCycles * 1e6 / SIMULATION_US, fastRate, bmsResponses * 1e6 / SIMULATION_US, fastRate / defaultRate);
+  }
+
+  return 0;
+}
@@ -0,0 +1,35 @@
+// formatNumber vs snprintf("%.*f") - ns per call on host (relative speed only, ESP32 has no FPU for double)
+
+#include <Arduino.h>
+#include <chrono>
+#define private public
+#include "../BoardTtgoT4v13.h"
+#undef private
+
+#define BENCH_CALLS 5000000
+
+int main() {
+
+  BoardTtgoT4v13* board = new BoardTtgoT4v13();
+  static const float values[] = {94.5, -1.8, 562.7, 0.02, -24.0, 14.5, 3.95, 128.25};
+  char buf[32];
+  volatile uint32_t sink = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < BENCH_CALLS; i++) {
+    board->formatNumber(buf, values[i & 7], i & 3);
+    sink += buf[0];
+  }
+  double formatNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / BENCH_CALLS;
+
+  start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < BENCH_CALLS; i++) {
+    snprintf(buf, sizeof(buf), "%.*f", (int)(i & 3), values[i & 7]);
+    sink += buf[0];
+  }
+  double printfNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / BENCH_CALLS;
+
+  printf("formatNumber %.1f ns/call, snprintf %.1f ns/call (%.1fx)\n", formatNs, printfNs, printfNs / formatNs);
+
+  return 0;
+}
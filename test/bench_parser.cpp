@@ -0,0 +1,129 @@
+// Response parser - ns per byte and heap allocations per response, String rows (before) vs ring buffer and fixed rows (now)
+// Built with COW std::string (no small string buffer), String allocates like Arduino String on ESP32
+
+#include <Arduino.h>
+#include <chrono>
+#include <new>
+#include "../evDash.ino"
+#include "../CarInterface.h"
+
+#define BENCH_RESPONSES 200000
+
+// 220101 of BMS (eNiro test data)
+#define BMS_220101 "620101FFF7E7FFB3000000000300120F9B111011101011000014CC38CB3B00009100003A510000367C000015FB000013D3000690250D018E0000000003E8"
+
+static uint32_t allocations = 0;
+
+// Not inlined, free of pointer from operator new is not reported as mismatched
+__attribute__((noinline)) void* operator new(size_t size) {
+
+  allocations++;
+  void* p = malloc(size ? size : 1);
+  if (p == NULL)
+    throw std::bad_alloc();
+  return p;
+}
+
+__attribute__((noinline)) void operator delete(void* p) noexcept { free(p); }
+__attribute__((noinline)) void operator delete(void* p, size_t) noexcept { free(p); }
+
+/**
+  Parser of 1.x - String row built per char, merged by substring (row split by notification is lost as in 1.x)
+*/
+static String legacyRow;
+static String legacyMerged;
+
+static void legacyNotify(uint8_t* pData, size_t length) {
+
+  char ch;
+
+  legacyRow = "";
+  for (size_t i = 0; i <= length; i++) {
+    ch = (i < length) ? pData[i] : '\0';
+    if (ch == '\r' || ch == '\n' || ch == '\0') {
+      if (legacyRow != "" && legacyRow.length() >= 2 && legacyRow.charAt(1) == ':') {
+        if (legacyRow.charAt(0) == '0')
+          legacyMerged = "";
+        legacyMerged += legacyRow.substring(2);
+      }
+      legacyRow = "";
+    } else {
+      legacyRow += ch;
+      if (legacyRow == ">") {
+        if (legacyMerged != "") {
+          liveData->setResponseMerged(legacyMerged.c_str());
+          car->parseMergedResponse();
+        }
+        legacyMerged = "";
+        liveData->canSendNextAtCommand = true;
+      }
+    }
+  }
+}
+
+/**
+  ELM output of ISO-TP response with prompt (length line, 0: with 6 bytes, N: with 7 bytes padded by AA)
+*/
+static size_t elmMultiFrame(char* elm, const char* merged) {
+
+  size_t length = strlen(merged) / 2;
+  char* out = elm + sprintf(elm, "%03X\r", (unsigned)length);
+
+  for (size_t from = 0, frame = 0; from < length; frame++) {
+    size_t count = (frame == 0) ? 6 : 7;
+    out += sprintf(out, "%X:", (unsigned)(frame % 16));
+    for (size_t i = 0; i < count; i++, from++)
+      out += sprintf(out, "%.2s", (from < length) ? merged + from * 2 : "AA");
+    *out++ = '\r';
+  }
+  out += sprintf(out, "\r>");
+
+  return out - elm;
+}
+
+int main() {
+
+  static char elm[1024];
+  size_t length = elmMultiFrame(elm, BMS_220101);
+  volatile uint32_t sink = 0;
+
+  liveData = new LiveData();
+  liveData->initParams();
+  board = new BoardTtgoT4v13();
+  board->setLiveData(liveData);
+  car = new CarKiaEniro();
+  car->setLiveData(liveData);
+  car->activateCommandQueue();
+  for (uint16_t i = 0; i < liveData->commandQueueCount; i++)
+    if (strcmp(liveData->commandQueue[i], "220101\r") == 0)
+      liveData->publishCommand("220101", 6, liveData->commandQueueKey[i], false);
+
+  // Legacy, BLE notifications of 20 bytes parsed in callback
+  uint32_t startAllocations = allocations;
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < BENCH_RESPONSES; i++) {
+    for (size_t j = 0; j < length; j += 20)
+      legacyNotify((uint8_t*)elm + j, (length - j < 20) ? length - j : 20);
+    sink += liveData->params.batVoltage;
+  }
+  double legacyNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / BENCH_RESPONSES / length;
+  double legacyAllocations = (double)(allocations - startAllocations) / BENCH_RESPONSES;
+
+  // Ring buffer filled by callback, rows and merged response in fixed buffers of parser task
+  startAllocations = allocations;
+  start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < BENCH_RESPONSES; i++) {
+    for (size_t j = 0; j < length; j += 20)
+      notifyCallback(NULL, (uint8_t*)elm + j, (length - j < 20) ? length - j : 20, true);
+    processResponse();
+    sink += liveData->params.batVoltage;
+  }
+  double parserNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / BENCH_RESPONSES / length;
+  double parserAllocations = (double)(allocations - startAllocations) / BENCH_RESPONSES;
+
+  printf("response of %u bytes (%u notifications)\n", (unsigned)length, (unsigned)((length + 19) / 20));
+  printf("String rows (before) %.2f ns/byte, %.1f allocations/response\n", legacyNs, legacyAllocations);
+  printf("fixed rows (now)     %.2f ns/byte, %.1f allocations/response (%.1fx)\n", parserNs, parserAllocations, legacyNs / parserNs);
+
+  return 0;
+}
@@ -0,0 +1,176 @@
+#ifndef LEGACY_ROWS_H
+#define LEGACY_ROWS_H
+
+// Formulas of string parser (v2.0.0) for loadTestData responses of each car (test_decode, bench_decode)
+
+#include <Arduino.h>
+#include "../LiveData.h"
+#include "../CarInterface.h"
+
+// Legacy formula, value = hexToDec(merged.substring(from, to), bytes, signedNum) * scale + valueOffset
+typedef struct {
+  const char* atsh;
+  const char* command;
+  uint16_t dest;        // PARAM(field)
+  uint16_t from;        // hex chars of merged response
+  uint16_t to;
+  uint8_t bytes;        // hexToDec bytes (strtol - 4 unsigned)
+  bool signedNum;
+  double scale;
+  double valueOffset;
+  uint8_t count;        // consecutive values, next substring moved by (to - from)
+  int16_t matchFrom;    // merged.substring(matchFrom, matchFrom + 2) == matchHex (-1 any)
+  const char* matchHex;
+} LEGACY_ROW;
+
+#define ROW(atsh, command, field, from, to, bytes, signedNum, scale, valueOffset) \
+  {atsh, command, PARAM(field), from, to, bytes, signedNum, scale, valueOffset, 1, -1, NULL}
+#define ROWS(atsh, command, field, from, to, bytes, signedNum, scale, valueOffset, count, matchFrom, matchHex) \
+  {atsh, command, PARAM(field), from, to, bytes, signedNum, scale, valueOffset, count, matchFrom, matchHex}
+
+// Kia eNiro / Hyundai Kona
+static const LEGACY_ROW legacyKiaENiro[] = {
+  ROW("ATSH7E2", "2101", speedKmh, 32, 36, 2, false, 0.0155, 0),
+  ROW("ATSH7E2", "2102", auxPerc, 50, 52, 1, false, 1, 0),
+  ROW("ATSH7E2", "2102", auxCurrentAmp, 46, 50, 2, true, -1 / 1000.0, 0),
+  ROW("ATSH7C6", "22B002", odoKm, 18, 24, 4, false, 1, 0),
+  ROW("ATSH7B3", "220100", indoorTemperature, 16, 18, 1, false, 0.5, -40),
+  ROW("ATSH7B3", "220100", outdoorTemperature, 18, 20, 1, false, 0.5, -40),
+  ROW("ATSH7E4", "220101", cumulativeEnergyChargedKWh, 82, 90, 4, false, 1 / 10.0, 0),
+  ROW("ATSH7E4", "220101", cumulativeEnergyDischargedKWh, 90, 98, 4, false, 1 / 10.0, 0),
+  ROW("ATSH7E4", "220101", availableChargePower, 16, 20, 4, false, 1 / 100.0, 0),
+  ROW("ATSH7E4", "220101", availableDischargePower, 20, 24, 4, false, 1 / 100.0, 0),
+  ROW("ATSH7E4", "220101", batFanStatus, 60, 62, 2, true, 1, 0),
+  ROW("ATSH7E4", "220101", batFanFeedbackHz, 62, 64, 2, true, 1, 0),
+  ROW("ATSH7E4", "220101", auxVoltage, 64, 66, 2, true, 1 / 10.0, 0),
+  ROW("ATSH7E4", "220101", batPowerAmp, 26, 30, 2, true, -1 / 10.0, 0),
+  ROW("ATSH7E4", "220101", batVoltage, 30, 34, 2, false, 1 / 10.0, 0),
+  ROW("ATSH7E4", "220101", batCellMaxV, 52, 54, 1, false, 1 / 50.0, 0),
+  ROW("ATSH7E4", "220101", batCellMinV, 56, 58, 1, false, 1 / 50.0, 0),
+  ROWS("ATSH7E4", "220101", batModuleTempC, 38, 40, 1, true, 1, 0, 4, -1, NULL),
+  ROW("ATSH7E4", "220101", motorRpm, 112, 116, 2, false, 1, 0),
+  ROW("ATSH7E4", "220101", batInletC, 50, 52, 1, true, 1, 0),
+  ROWS("ATSH7E4", "220102", cellVoltage[0], 14, 16, 1, false, 1 / 50.0, 0, 32, 12, "FF"),
+  ROWS("ATSH7E4", "220103", cellVoltage[32], 14, 16, 1, false, 1 / 50.0, 0, 32, -1, NULL),
+  ROWS("ATSH7E4", "220104", cellVoltage[64], 14, 16, 1, false, 1 / 50.0, 0, 32, -1, NULL),
+  ROW("ATSH7E4", "220105", sohPerc, 56, 60, 2, false, 1 / 10.0, 0),
+  ROW("ATSH7E4", "220105", socPerc, 68, 70, 1, false, 1 / 2.0, 0),
+  ROW("ATSH7E4", "220105", bmsUnknownTempA, 30, 32, 1, true, 1, 0),
+  ROW("ATSH7E4", "220105", batHeaterC, 52, 54, 1, true, 1, 0),
+  ROW("ATSH7E4", "220105", bmsUnknownTempB, 82, 84, 1, true, 1, 0),
+  ROWS("ATSH7E4", "220105", cellVoltage[96], 74, 76, 1, false, 1 / 50.0, 0, 2, -1, NULL),
+  ROW("ATSH7E4", "220106", coolingWaterTempC, 14, 16, 1, false, 1, 0),
+  ROW("ATSH7E4", "220106", bmsUnknownTempC, 18, 20, 1, true, 1, 0),
+  ROW("ATSH7E4", "220106", bmsUnknownTempD, 46, 48, 1, true, 1, 0),
+  ROW("ATSH7A0", "22C00B", tireFrontLeftPressureBar, 14, 16, 2, false, 1 / 72.51886900361, 0),
+  ROW("ATSH7A0", "22C00B", tireFrontRightPressureBar, 22, 24, 2, false, 1 / 72.51886900361, 0),
+  ROW("ATSH7A0", "22C00B", tireRearRightPressureBar, 30, 32, 2, false, 1 / 72.51886900361, 0),
+  ROW("ATSH7A0", "22C00B", tireRearLeftPressureBar, 38, 40, 2, false, 1 / 72.51886900361, 0),
+  ROW("ATSH7A0", "22C00B", tireFrontLeftTempC, 16, 18, 2, false, 1, -50),
+  ROW("ATSH7A0", "22C00B", tireFrontRightTempC, 24, 26, 2, false, 1, -50),
+  ROW("ATSH7A0", "22C00B", tireRearRightTempC, 32, 34, 2, false, 1, -50),
+  ROW("ATSH7A0", "22C00B", tireRearLeftTempC, 40, 42, 2, false, 1, -50),
+};
+
+// Hyundai Ioniq 28kWh
+static const LEGACY_ROW legacyHyundaiIoniq[] = {
+  ROW("ATSH7E2", "2101", speedKmh, 32, 36, 2, false, 0.0155, 0),
+  ROW("ATSH7E2", "2102", auxPerc, 50, 52, 1, false, 1, 0),
+  ROW("ATSH7E2", "2102", auxCurrentAmp, 46, 50, 2, true, -1 / 1000.0, 0),
+  ROW("ATSH7C6", "22B002", odoKm, 18, 24, 4, false, 1, 0),
+  ROW("ATSH7B3", "220100", indoorTemperature, 16, 18, 1, false, 0.5, -40),
+  ROW("ATSH7B3", "220100", outdoorTemperature, 18, 20, 1, false, 0.5, -40),
+  ROW("ATSH7E4", "2101", cumulativeEnergyChargedKWh, 80, 88, 4, false, 1 / 10.0, 0),
+  ROW("ATSH7E4", "2101", cumulativeEnergyDischargedKWh, 88, 96, 4, false, 1 / 10.0, 0),
+  ROW("ATSH7E4", "2101", availableChargePower, 16, 20, 4, false, 1 / 100.0, 0),
+  ROW("ATSH7E4", "2101", availableDischargePower, 20, 24, 4, false, 1 / 100.0, 0),
+  ROW("ATSH7E4", "2101", isolationResistanceKOhm, 118, 122, 2, true, 1, 0),
+  ROW("ATSH7E4", "2101", batFanStatus, 58, 60, 2, true, 1, 0),
+  ROW("ATSH7E4", "2101", batFanFeedbackHz, 60, 62, 2, true, 1, 0),
+  ROW("ATSH7E4", "2101", auxVoltage, 62, 64, 2, true, 1 / 10.0, 0),
+  ROW("ATSH7E4", "2101", batPowerAmp, 24, 28, 2, true, -1 / 10.0, 0),
+  ROW("ATSH7E4", "2101", batVoltage, 28, 32, 2, false, 1 / 10.0, 0),
+  ROW("ATSH7E4", "2101", batCellMaxV, 50, 52, 1, false, 1 / 50.0, 0),
+  ROW("ATSH7E4", "2101", batCellMinV, 54, 56, 1, false, 1 / 50.0, 0),
+  ROWS("ATSH7E4", "2101", batModuleTempC, 36, 38, 1, true, 1, 0, 5, -1, NULL),
+  ROW("ATSH7E4", "2101", batInletC, 48, 50, 1, true, 1, 0),
+  ROWS("ATSH7E4", "2102", cellVoltage[0], 12, 14, 1, false, 1 / 50.0, 0, 32, 10, "FF"),
+  ROWS("ATSH7E4", "2103", cellVoltage[32], 12, 14, 1, false, 1 / 50.0, 0, 32, -1, NULL),
+  ROWS("ATSH7E4", "2104", cellVoltage[64], 12, 14, 1, false, 1 / 50.0, 0, 32, -1, NULL),
+  ROW("ATSH7E4", "2105", sohPerc, 54, 58, 2, false, 1 / 10.0, 0),
+  ROW("ATSH7E4", "2105", socPerc, 66, 68, 1, false, 1 / 2.0, 0),
+  ROWS("ATSH7E4", "2105", batModuleTempC[5], 22, 24, 1, true, 1, 0, 7, -1, NULL),
+  ROW("ATSH7E4", "2105", batHeaterC, 50, 52, 1, true, 1, 0),
+  // 2106 coolingWaterTempC - test data is negative response
+  ROW("ATSH7A0", "22C00B", tireFrontLeftPressureBar, 14, 16, 2, false, 1 / 72.51886900361, 0),
+  ROW("ATSH7A0", "22C00B", tireFrontRightPressureBar, 22, 24, 2, false, 1 / 72.51886900361, 0),
+  ROW("ATSH7A0", "22C00B", tireRearRightPressureBar, 30, 32, 2, false, 1 / 72.51886900361, 0),
+  ROW("ATSH7A0", "22C00B", tireRearLeftPressureBar, 38, 40, 2, false, 1 / 72.51886900361, 0),
+  ROW("ATSH7A0", "22C00B", tireFrontLeftTempC, 16, 18, 2, false, 1, -50),
+  ROW("ATSH7A0", "22C00B", tireFrontRightTempC, 24, 26, 2, false, 1, -50),
+  ROW("ATSH7A0", "22C00B", tireRearRightTempC, 32, 34, 2, false, 1, -50),
+  ROW("ATSH7A0", "22C00B", tireRearLeftTempC, 40, 42, 2, false, 1, -50),
+};
+
+// Kia debug OBD2
+static const LEGACY_ROW legacyKiaDebugObd2[] = {
+  ROW("ATSH7E2", "2101", speedKmh, 32, 36, 2, false, 0.0155, 0),
+  ROW("ATSH7E2", "2102", auxPerc, 50, 52, 1, false, 1, 0),
+  ROW("ATSH7E2", "2102", auxCurrentAmp, 46, 50, 2, true, -1 / 1000.0, 0),
+  ROW("ATSH7C6", "22B002", odoKm, 18, 24, 4, false, 1, 0),
+  ROW("ATSH7B3", "220100", indoorTemperature, 16, 18, 1, false, 0.5, -40),
+  ROW("ATSH7B3", "220100", outdoorTemperature, 18, 20, 1, false, 0.5, -40),
+  ROW("ATSH7E4", "220101", cumulativeEnergyChargedKWh, 82, 90, 4, false, 1 / 10.0, 0),
+  ROW("ATSH7E4", "220101", cumulativeEnergyDischargedKWh, 90, 98, 4, false, 1 / 10.0, 0),
+  ROW("ATSH7E4", "220101", auxVoltage, 64, 66, 2, true, 1 / 10.0, 0),
+  ROW("ATSH7E4", "220101", batPowerAmp, 26, 30, 2, true, -1 / 10.0, 0),
+  ROW("ATSH7E4", "220101", batVoltage, 30, 34, 2, false, 1 / 10.0, 0),
+  ROW("ATSH7E4", "220101", batCellMaxV, 52, 54, 1, false, 1 / 50.0, 0),
+  ROW("ATSH7E4", "220101", batCellMinV, 56, 58, 1, false, 1 / 50.0, 0),
+  ROWS("ATSH7E4", "220101", batModuleTempC, 38, 40, 1, true, 1, 0, 4, -1, NULL),
+  ROW("ATSH7E4", "220101", batInletC, 50, 52, 1, true, 1, 0),
+  ROWS("ATSH7E4", "220102", cellVoltage[0], 14, 16, 1, false, 1 / 50.0, 0, 32, 12, "FF"),
+  ROWS("ATSH7E4", "220103", cellVoltage[32], 14, 16, 1, false, 1 / 50.0, 0, 32, -1, NULL),
+  ROWS("ATSH7E4", "220104", cellVoltage[64], 14, 16, 1, false, 1 / 50.0, 0, 32, -1, NULL),
+  ROW("ATSH7E4", "220105", sohPerc, 56, 60, 2, false, 1 / 10.0, 0),
+  ROW("ATSH7E4", "220105", socPerc, 68, 70, 1, false, 1 / 2.0, 0),
+  ROW("ATSH7E4", "220105", batHeaterC, 52, 54, 1, true, 1, 0),
+  ROWS("ATSH7E4", "220105", cellVoltage[96], 74, 76, 1, false, 1 / 50.0, 0, 2, -1, NULL),
+  ROW("ATSH7E4", "220106", coolingWaterTempC, 14, 16, 1, false, 1, 0),
+  ROW("ATSH7A0", "22C00B", tireFrontLeftPressureBar, 14, 16, 2, false, 1 / 72.51886900361, 0),
+  ROW("ATSH7A0", "22C00B", tireFrontRightPressureBar, 22, 24, 2, false, 1 / 72.51886900361, 0),
+  ROW("ATSH7A0", "22C00B", tireRearRightPressureBar, 30, 32, 2, false, 1 / 72.51886900361, 0),
+  ROW("ATSH7A0", "22C00B", tireRearLeftPressureBar, 38, 40, 2, false, 1 / 72.51886900361, 0),
+  ROW("ATSH7A0", "22C00B", tireFrontLeftTempC, 16, 18, 2, false, 1, -50),
+  ROW("ATSH7A0", "22C00B", tireFrontRightTempC, 24, 26, 2, false, 1, -50),
+  ROW("ATSH7A0", "22C00B", tireRearRightTempC, 32, 34, 2, false, 1, -50),
+  ROW("ATSH7A0", "22C00B", tireRearLeftTempC, 40, 42, 2, false, 1, -50),
+};
+
+/**
+  hexToDec of string parser (v2.0.0)
+*/
+static float legacyHexToDec(String hexString, byte bytes, bool signedNum) {
+
+  unsigned int decValue = 0;
+  unsigned int nextInt;
+
+  for (unsigned int i = 0; i < hexString.length(); i++) {
+    nextInt = int(hexString.charAt(i));
+    if (nextInt >= 48 && nextInt <= 57) nextInt = map(nextInt, 48, 57, 0, 9);
+    if (nextInt >= 65 && nextInt <= 70) nextInt = map(nextInt, 65, 70, 10, 15);
+    if (nextInt >= 97 && nextInt <= 102) nextInt = map(nextInt, 97, 102, 10, 15);
+    nextInt = std::min(nextInt, 15u);
+    decValue = (decValue * 16) + nextInt;
+  }
+
+  if (!signedNum) {
+    return decValue;
+  }
+  if (bytes == 1) {
+    return (decValue > 127 ? (float)decValue - 256.0 : decValue);
+  }
+  return (decValue > 32767 ? (float)decValue - 65536.0 : decValue);
+}
+
+#endif // LEGACY_ROWS_H
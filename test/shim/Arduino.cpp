@@ -0,0 +1,139 @@
+#include "Arduino.h"
+#include "EEPROM.h"
+#include "analogWrite.h"
+
+unsigned long shimMillis = 0;
+bool shimPsram = true;
+HardwareSerial Serial;
+EspClass ESP;
+EEPROMClass EEPROM;
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+unsigned long millis() {
+  return shimMillis;
+}
+
+/**
+  Frame timings are constant on host (golden images)
+*/
+unsigned long micros() {
+  return shimMillis * 1000;
+}
+
+void delay(unsigned long ms) {
+  shimMillis += ms;
+}
+
+/**
+  Buttons are released (HIGH)
+*/
+int digitalRead(uint8_t pin) {
+  return HIGH;
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {}
+void dacWrite(uint8_t pin, uint8_t value) {}
+void analogWrite(uint8_t pin, int value) {}
+void setCpuFrequencyMhz(int mhz) {}
+void btStop() {}
+void esp_bt_controller_disable() {}
+void esp_deep_sleep_start() {}
+
+bool psramFound() {
+  return shimPsram;
+}
+
+void* ps_malloc(size_t size) {
+  return malloc(size);
+}
+
+/**
+  Fixed local time (2020-05-09 08:11:13 UTC)
+*/
+bool getLocalTime(struct tm* info, uint32_t ms) {
+  time_t now = 1589011873;
+  gmtime_r(&now, info);
+  return true;
+}
+
+#ifdef SHIM_STRLCPY
+extern "C" size_t strlcpy(char* dst, const char* src, size_t size) {
+  size_t length = strlen(src);
+  if (size != 0) {
+    size_t n = (length >= size) ? size - 1 : length;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return length;
+}
+
+extern "C" size_t strlcat(char* dst, const char* src, size_t size) {
+  size_t length = strnlen(dst, size);
+  if (length == size)
+    return length + strlen(src);
+  return length + strlcpy(dst + length, src, size - length);
+}
+#endif
+
+String::String(float v, unsigned char decimals) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+  s = buf;
+}
+
+String String::substring(unsigned int from) const {
+  return substring(from, s.size());
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+  String result;
+  if (from > to)
+    std::swap(from, to);
+  if (to > s.size())
+    to = s.size();
+  if (from < to)
+    result.s = s.substr(from, to - from);
+  return result;
+}
+
+void String::toCharArray(char* buf, unsigned int size, unsigned int index) const {
+  if (size == 0)
+    return;
+  strlcpy(buf, (index < s.size()) ? s.c_str() + index : "", size);
+}
+
+void String::replace(const String& find, const String& with) {
+  if (find.s.empty())
+    return;
+  for (size_t pos = s.find(find.s); pos != std::string::npos; pos = s.find(find.s, pos + with.s.size()))
+    s.replace(pos, find.s.size(), with.s);
+}
+
+int String::indexOf(char c) const {
+  size_t pos = s.find(c);
+  return (pos == std::string::npos) ? -1 : (int)pos;
+}
+
+void String::toUpperCase() {
+  for (size_t i = 0; i < s.size(); i++)
+    s[i] = toupper(s[i]);
+}
+
+size_t HardwareSerial::write(const char* text) {
+  static bool enabled = (getenv("SHIM_SERIAL") != NULL);
+  if (enabled)
+    fputs(text, stdout);
+  return strlen(text);
+}
+
+size_t HardwareSerial::printf(const char* format, ...) {
+  char buf[256];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  return write(buf);
+}
@@ -0,0 +1,131 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+// Host shim of Arduino core (only what evDash uses), time is driven by tests
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <string.h>
+#include <strings.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <ctype.h>
+#include <string>
+#include <algorithm>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define F(x) x
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define ESP32 1
+#define CONFIG_SPIRAM_SUPPORT 1
+
+// Host time (ms), set by tests
+extern unsigned long shimMillis;
+// psramFound() result (false - strip rendering)
+extern bool shimPsram;
+
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+int digitalRead(uint8_t pin);
+void pinMode(uint8_t pin, uint8_t mode);
+void dacWrite(uint8_t pin, uint8_t value);
+bool psramFound();
+void* ps_malloc(size_t size);
+void setCpuFrequencyMhz(int mhz);
+void btStop();
+void esp_bt_controller_disable();
+void esp_deep_sleep_start();
+bool getLocalTime(struct tm* info, uint32_t ms);
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 38)
+#define SHIM_STRLCPY
+extern "C" size_t strlcpy(char* dst, const char* src, size_t size);
+extern "C" size_t strlcat(char* dst, const char* src, size_t size);
+#endif
+
+class String {
+  public:
+    std::string s;
+    String(const char* c = "") : s(c ? c : "") {}
+    String(const String& o) : s(o.s) {}
+    String(char c) : s(1, c) {}
+    String(int v) : s(std::to_string(v)) {}
+    String(unsigned int v) : s(std::to_string(v)) {}
+    String(long v) : s(std::to_string(v)) {}
+    String(unsigned long v) : s(std::to_string(v)) {}
+    String(float v, unsigned char decimals = 2);
+    String& operator=(const String& o) { s = o.s; return *this; }
+    String& operator=(const char* c) { s = c ? c : ""; return *this; }
+    String& operator+=(const String& o) { s += o.s; return *this; }
+    String& operator+=(const char* c) { s += c; return *this; }
+    String& operator+=(char c) { s += c; return *this; }
+    bool concat(const char* c) { s += c; return true; }
+    bool concat(const char* c, unsigned int n) { s.append(c, n); return true; }
+    bool concat(char c) { s += c; return true; }
+    bool reserve(unsigned int n) { s.reserve(n); return true; }
+    friend String operator+(const String& a, const String& b) { String r(a); r.s += b.s; return r; }
+    friend String operator+(const String& a, const char* b) { String r(a); r.s += b; return r; }
+    friend String operator+(const char* a, const String& b) { String r(a); r.s += b.s; return r; }
+    friend String operator+(const String& a, char b) { String r(a); r.s += b; return r; }
+    bool operator==(const String& o) const { return s == o.s; }
+    bool operator==(const char* c) const { return s == c; }
+    bool operator!=(const String& o) const { return s != o.s; }
+    bool operator!=(const char* c) const { return s != c; }
+    bool equals(const String& o) const { return s == o.s; }
+    bool equals(const char* c) const { return s == c; }
+    bool equalsIgnoreCase(const String& o) const { return strcasecmp(s.c_str(), o.s.c_str()) == 0; }
+    bool startsWith(const String& o) const { return s.compare(0, o.s.size(), o.s) == 0; }
+    char charAt(unsigned int i) const { return (i < s.size()) ? s[i] : 0; }
+    unsigned int length() const { return s.size(); }
+    const char* c_str() const { return s.c_str(); }
+    String substring(unsigned int from) const;
+    String substring(unsigned int from, unsigned int to) const;
+    void toCharArray(char* buf, unsigned int size, unsigned int index = 0) const;
+    void replace(const String& find, const String& with);
+    int indexOf(char c) const;
+    void toUpperCase();
+    long toInt() const { return atol(s.c_str()); }
+};
+
+// Serial output is discarded unless SHIM_SERIAL is set in environment
+class HardwareSerial {
+  public:
+    void begin(long baud) {}
+    int available() { return 0; }
+    int read() { return -1; }
+    size_t print(const String& v) { return write(v.c_str()); }
+    size_t print(const char* v) { return write(v); }
+    size_t print(char v) { char c[2] = {v, 0}; return write(c); }
+    size_t print(long v, int base = 10) { return printf((base == 16) ? "%lX" : "%ld", v); }
+    size_t print(int v, int base = 10) { return print((long)v, base); }
+    size_t print(unsigned long v, int base = 10) { return printf((base == 16) ? "%lX" : "%lu", v); }
+    size_t print(unsigned int v, int base = 10) { return print((unsigned long)v, base); }
+    size_t print(double v, int decimals = 2) { return printf("%.*f", decimals, v); }
+    template<typename T> size_t println(T v) { return print(v) + write("\n"); }
+    template<typename T> size_t println(T v, int f) { return print(v, f) + write("\n"); }
+    size_t println() { return write("\n"); }
+    size_t printf(const char* format, ...);
+  private:
+    size_t write(const char* text);
+};
+extern HardwareSerial Serial;
+
+class EspClass {
+  public:
+    void restart() {}
+    uint32_t getFreeHeap() { return 0; }
+};
+extern EspClass ESP;
+
+#endif // ARDUINO_H
@@ -0,0 +1,132 @@
+#ifndef BLEDEVICE_H
+#define BLEDEVICE_H
+
+// Host shim of ESP32 BLE, characteristic records written bytes (adapter replay tests)
+
+#include <Arduino.h>
+#include <string>
+
+#define BLE_ADDR_TYPE_RANDOM 1
+#define ESP_BLE_SEC_ENCRYPT 1
+#define ESP_LE_AUTH_BOND 1
+#define ESP_IO_CAP_KBDISP 1
+#define ESP_BLE_ENC_KEY_MASK 1
+#define ESP_BLE_ID_KEY_MASK 2
+
+struct esp_ble_auth_cmpl_t {
+  bool success;
+};
+
+class BLEUUID {
+  public:
+    BLEUUID(const char* uuid) {}
+    BLEUUID(uint16_t uuid) {}
+    std::string toString() { return ""; }
+};
+
+class BLEAddress {
+  public:
+    BLEAddress(const char* address) : address(address) {}
+    std::string toString() { return address; }
+  private:
+    std::string address;
+};
+
+class BLERemoteDescriptor {
+  public:
+    void writeValue(uint8_t* data, size_t length, bool response = false) {}
+};
+
+class BLERemoteCharacteristic;
+typedef void (*notify_callback)(BLERemoteCharacteristic*, uint8_t*, size_t, bool);
+
+class BLERemoteCharacteristic {
+  public:
+    std::string written; // all bytes sent to adapter
+    void writeValue(const char* data, size_t length, bool response = false) { written.append(data, length); }
+    void writeValue(uint8_t* data, size_t length, bool response = false) { written.append((const char*)data, length); }
+    bool canNotify() { return true; }
+    bool canIndicate() { return true; }
+    bool canWrite() { return true; }
+    BLERemoteDescriptor* getDescriptor(BLEUUID uuid) { return &descriptor; }
+    void registerForNotify(notify_callback callback, bool notifications = true) {}
+  private:
+    BLERemoteDescriptor descriptor;
+};
+
+class BLERemoteService {
+  public:
+    BLERemoteCharacteristic* getCharacteristic(BLEUUID uuid) { return NULL; }
+};
+
+class BLEClient;
+class BLEClientCallbacks {
+  public:
+    virtual void onConnect(BLEClient* client) = 0;
+    virtual void onDisconnect(BLEClient* client) = 0;
+};
+
+class BLEClient {
+  public:
+    void setClientCallbacks(BLEClientCallbacks* callbacks) {}
+    bool connect(BLEAddress address, int type = 0) { return false; }
+    BLERemoteService* getService(BLEUUID uuid) { return NULL; }
+};
+
+class BLEAdvertisedDevice {
+  public:
+    std::string toString() { return ""; }
+    BLEAddress getAddress() { return BLEAddress(""); }
+    bool haveServiceUUID() { return false; }
+    bool isAdvertisingService(BLEUUID uuid) { return false; }
+    BLEUUID getServiceDataUUID() { return BLEUUID((uint16_t)0); }
+    BLEUUID getServiceUUID() { return BLEUUID((uint16_t)0); }
+};
+
+class BLEAdvertisedDeviceCallbacks {
+  public:
+    virtual void onResult(BLEAdvertisedDevice device) = 0;
+};
+
+class BLEScanResults {
+  public:
+    int getCount() { return 0; }
+};
+
+class BLEScan {
+  public:
+    void setAdvertisedDeviceCallbacks(BLEAdvertisedDeviceCallbacks* callbacks) {}
+    void setInterval(int interval) {}
+    void setWindow(int window) {}
+    void setActiveScan(bool active) {}
+    BLEScanResults start(int seconds, bool continuous) { return BLEScanResults(); }
+    void stop() {}
+    void clearResults() {}
+};
+
+class BLESecurityCallbacks {
+  public:
+    virtual uint32_t onPassKeyRequest() = 0;
+    virtual void onPassKeyNotify(uint32_t key) = 0;
+    virtual bool onConfirmPIN(uint32_t key) = 0;
+    virtual bool onSecurityRequest() = 0;
+    virtual void onAuthenticationComplete(esp_ble_auth_cmpl_t result) = 0;
+};
+
+class BLESecurity {
+  public:
+    void setAuthenticationMode(int mode) {}
+    void setCapability(int capability) {}
+    void setRespEncryptionKey(int key) {}
+};
+
+class BLEDevice {
+  public:
+    static void init(const char* name) {}
+    static BLEScan* getScan() { static BLEScan scan; return &scan; }
+    static void setEncryptionLevel(int level) {}
+    static void setSecurityCallbacks(BLESecurityCallbacks* callbacks) {}
+    static BLEClient* createClient() { return new BLEClient(); }
+};
+
+#endif // BLEDEVICE_H
@@ -0,0 +1,19 @@
+#ifndef EEPROM_H
+#define EEPROM_H
+
+#include <string.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Host shim of ESP32 EEPROM (RAM only, starts zeroed)
+class EEPROMClass {
+  public:
+    uint8_t data[4096] = {0};
+    bool begin(size_t size) { return size <= sizeof(data); }
+    template<typename T> T& get(int address, T& value) { memcpy(&value, data + address, sizeof(T)); return value; }
+    template<typename T> const T& put(int address, const T& value) { memcpy(data + address, &value, sizeof(T)); return value; }
+    bool commit() { return true; }
+};
+extern EEPROMClass EEPROM;
+
+#endif // EEPROM_H
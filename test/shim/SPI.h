@@ -0,0 +1,3 @@
+#ifndef SPI_H
+#define SPI_H
+#endif // SPI_H
@@ -0,0 +1,282 @@
+#include "TFT_eSPI.h"
+
+const GFXfont Roboto_Thin_24 = { 24 };
+const GFXfont Orbitron_Light_24 = { 24 };
+const GFXfont Orbitron_Light_32 = { 32 };
+
+// Classic 5x7 GLCD font 0x20-0x7E, 5 columns per char, LSB is top row
+static const uint8_t glcdFont[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x14, 0x7F, 0x14, 0x7F, 0x14,
+  0x24, 0x2A, 0x7F, 0x2A, 0x12, 0x23, 0x13, 0x08, 0x64, 0x62, 0x36, 0x49, 0x56, 0x20, 0x50, 0x00, 0x08, 0x07, 0x03, 0x00,
+  0x00, 0x1C, 0x22, 0x41, 0x00, 0x00, 0x41, 0x22, 0x1C, 0x00, 0x2A, 0x1C, 0x7F, 0x1C, 0x2A, 0x08, 0x08, 0x3E, 0x08, 0x08,
+  0x00, 0x80, 0x70, 0x30, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x60, 0x60, 0x00, 0x20, 0x10, 0x08, 0x04, 0x02,
+  0x3E, 0x51, 0x49, 0x45, 0x3E, 0x00, 0x42, 0x7F, 0x40, 0x00, 0x72, 0x49, 0x49, 0x49, 0x46, 0x21, 0x41, 0x49, 0x4D, 0x33,
+  0x18, 0x14, 0x12, 0x7F, 0x10, 0x27, 0x45, 0x45, 0x45, 0x39, 0x3C, 0x4A, 0x49, 0x49, 0x31, 0x41, 0x21, 0x11, 0x09, 0x07,
+  0x36, 0x49, 0x49, 0x49, 0x36, 0x46, 0x49, 0x49, 0x29, 0x1E, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x34, 0x00, 0x00,
+  0x00, 0x08, 0x14, 0x22, 0x41, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x41, 0x22, 0x14, 0x08, 0x02, 0x01, 0x59, 0x09, 0x06,
+  0x3E, 0x41, 0x5D, 0x59, 0x4E, 0x7C, 0x12, 0x11, 0x12, 0x7C, 0x7F, 0x49, 0x49, 0x49, 0x36, 0x3E, 0x41, 0x41, 0x41, 0x22,
+  0x7F, 0x41, 0x41, 0x41, 0x3E, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x7F, 0x09, 0x09, 0x09, 0x01, 0x3E, 0x41, 0x41, 0x51, 0x73,
+  0x7F, 0x08, 0x08, 0x08, 0x7F, 0x00, 0x41, 0x7F, 0x41, 0x00, 0x20, 0x40, 0x41, 0x3F, 0x01, 0x7F, 0x08, 0x14, 0x22, 0x41,
+  0x7F, 0x40, 0x40, 0x40, 0x40, 0x7F, 0x02, 0x1C, 0x02, 0x7F, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x3E, 0x41, 0x41, 0x41, 0x3E,
+  0x7F, 0x09, 0x09, 0x09, 0x06, 0x3E, 0x41, 0x51, 0x21, 0x5E, 0x7F, 0x09, 0x19, 0x29, 0x46, 0x26, 0x49, 0x49, 0x49, 0x32,
+  0x03, 0x01, 0x7F, 0x01, 0x03, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x1F, 0x20, 0x40, 0x20, 0x1F, 0x3F, 0x40, 0x38, 0x40, 0x3F,
+  0x63, 0x14, 0x08, 0x14, 0x63, 0x03, 0x04, 0x78, 0x04, 0x03, 0x61, 0x59, 0x49, 0x4D, 0x43, 0x00, 0x7F, 0x41, 0x41, 0x41,
+  0x02, 0x04, 0x08, 0x10, 0x20, 0x00, 0x41, 0x41, 0x41, 0x7F, 0x04, 0x02, 0x01, 0x02, 0x04, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x00, 0x03, 0x07, 0x08, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x7F, 0x28, 0x44, 0x44, 0x38, 0x38, 0x44, 0x44, 0x44, 0x28,
+  0x38, 0x44, 0x44, 0x28, 0x7F, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x08, 0x7E, 0x09, 0x02, 0x18, 0xA4, 0xA4, 0x9C, 0x78,
+  0x7F, 0x08, 0x04, 0x04, 0x78, 0x00, 0x44, 0x7D, 0x40, 0x00, 0x20, 0x40, 0x40, 0x3D, 0x00, 0x7F, 0x10, 0x28, 0x44, 0x00,
+  0x00, 0x41, 0x7F, 0x40, 0x00, 0x7C, 0x04, 0x78, 0x04, 0x78, 0x7C, 0x08, 0x04, 0x04, 0x78, 0x38, 0x44, 0x44, 0x44, 0x38,
+  0xFC, 0x18, 0x24, 0x24, 0x18, 0x18, 0x24, 0x24, 0x18, 0xFC, 0x7C, 0x08, 0x04, 0x04, 0x08, 0x48, 0x54, 0x54, 0x54, 0x24,
+  0x04, 0x04, 0x3F, 0x44, 0x24, 0x3C, 0x40, 0x40, 0x20, 0x7C, 0x1C, 0x20, 0x40, 0x20, 0x1C, 0x3C, 0x40, 0x30, 0x40, 0x3C,
+  0x44, 0x28, 0x10, 0x28, 0x44, 0x4C, 0x90, 0x90, 0x90, 0x7C, 0x44, 0x64, 0x54, 0x4C, 0x44, 0x00, 0x08, 0x36, 0x41, 0x00,
+  0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x41, 0x36, 0x08, 0x00, 0x02, 0x01, 0x02, 0x04, 0x02,
+};
+
+/**
+  Display - physical panel 240x320
+*/
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h) {
+  _width = w;
+  _height = h;
+  buffer.assign(w * h, 0);
+  resetViewport();
+}
+
+void TFT_eSPI::setRotation(uint8_t r) {
+  rotation = r;
+  _width = (r & 1) ? 320 : 240;
+  _height = (r & 1) ? 240 : 320;
+  resetViewport();
+}
+
+void TFT_eSPI::writePixel(int32_t x, int32_t y, uint16_t color) {
+  int32_t px, py;
+  switch (rotation) {
+    case 1: px = y; py = x; break;
+    case 2: px = 239 - x; py = 319 - y; break;
+    case 3: px = 239 - y; py = 319 - x; break;
+    case 6: px = 239 - x; py = y; break;
+    default: px = x; py = y; break;
+  }
+  buffer[py * 240 + px] = color;
+}
+
+uint16_t TFT_eSPI::getPixel(int32_t x, int32_t y) {
+  int32_t px, py;
+  switch (rotation) {
+    case 1: px = y; py = x; break;
+    case 2: px = 239 - x; py = 319 - y; break;
+    case 3: px = 239 - y; py = 319 - x; break;
+    case 6: px = 239 - x; py = y; break;
+    default: px = x; py = y; break;
+  }
+  return buffer[py * 240 + px];
+}
+
+void TFT_eSPI::readScreen(std::vector<uint16_t>& pixels) {
+  pixels.resize(_width * _height);
+  for (int32_t y = 0; y < _height; y++)
+    for (int32_t x = 0; x < _width; x++)
+      pixels[y * _width + x] = getPixel(x, y);
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y) {
+  if (x < 0 || y < 0 || x >= _width || y >= _height)
+    return 0;
+  return getPixel(x, y);
+}
+
+/**
+  Viewport - datum moves to x,y, drawing is clipped to viewport and sprite area
+*/
+void TFT_eSPI::setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum) {
+  vpDatumX = (vpDatum) ? x : 0;
+  vpDatumY = (vpDatum) ? y : 0;
+  clipX1 = std::max<int32_t>(x, 0);
+  clipY1 = std::max<int32_t>(y, 0);
+  clipX2 = std::min<int32_t>(x + w, _width);
+  clipY2 = std::min<int32_t>(y + h, _height);
+}
+
+void TFT_eSPI::resetViewport() {
+  vpDatumX = vpDatumY = 0;
+  clipX1 = clipY1 = 0;
+  clipX2 = _width;
+  clipY2 = _height;
+}
+
+/**
+  Primitives
+*/
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  x += vpDatumX;
+  y += vpDatumY;
+  if (x < clipX1 || y < clipY1 || x >= clipX2 || y >= clipY2)
+    return;
+  writePixel(x, y, color);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  int32_t x1 = std::max(x + vpDatumX, clipX1), y1 = std::max(y + vpDatumY, clipY1);
+  int32_t x2 = std::min(x + vpDatumX + w, clipX2), y2 = std::min(y + vpDatumY + h, clipY2);
+  for (int32_t j = y1; j < y2; j++)
+    for (int32_t i = x1; i < x2; i++)
+      writePixel(i, j, color);
+}
+
+void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color) {
+  int32_t dx = abs(x1 - x0), sx = (x0 < x1) ? 1 : -1;
+  int32_t dy = -abs(y1 - y0), sy = (y0 < y1) ? 1 : -1;
+  int32_t err = dx + dy;
+  while (true) {
+    drawPixel(x0, y0, color);
+    if (x0 == x1 && y0 == y1)
+      break;
+    int32_t e2 = 2 * err;
+    if (e2 >= dy) { err += dy; x0 += sx; }
+    if (e2 <= dx) { err += dx; y0 += sy; }
+  }
+}
+
+void TFT_eSPI::fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color) {
+  int32_t minX = std::min({x0, x1, x2}), maxX = std::max({x0, x1, x2});
+  int32_t minY = std::min({y0, y1, y2}), maxY = std::max({y0, y1, y2});
+  int64_t area = (int64_t)(x1 - x0) * (y2 - y0) - (int64_t)(x2 - x0) * (y1 - y0);
+  if (area == 0)
+    return;
+  for (int32_t y = minY; y <= maxY; y++) {
+    for (int32_t x = minX; x <= maxX; x++) {
+      int64_t w0 = (int64_t)(x1 - x) * (y2 - y) - (int64_t)(x2 - x) * (y1 - y);
+      int64_t w1 = (int64_t)(x2 - x) * (y0 - y) - (int64_t)(x0 - x) * (y2 - y);
+      int64_t w2 = (int64_t)(x0 - x) * (y1 - y) - (int64_t)(x1 - x) * (y0 - y);
+      if ((area > 0 && w0 >= 0 && w1 >= 0 && w2 >= 0) || (area < 0 && w0 <= 0 && w1 <= 0 && w2 <= 0))
+        drawPixel(x, y, color);
+    }
+  }
+}
+
+void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+  for (int32_t dy = -r; dy <= r; dy++) {
+    int32_t dx = 0;
+    while ((dx + 1) * (dx + 1) + dy * dy <= r * r + r)
+      dx++;
+    fillRect(x0 - dx, y0 + dy, 2 * dx + 1, 1, color);
+  }
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data) {
+  for (int32_t j = 0; j < h; j++)
+    for (int32_t i = 0; i < w; i++)
+      drawPixel(x + i, y + j, data[j * w + i]);
+}
+
+/**
+  Text - GLCD font scaled to height of real font
+*/
+uint8_t TFT_eSPI::fontScale(uint8_t font) {
+  if (font == 1 && freeFont != NULL)
+    return (freeFont->yAdvance / 8) * textSize;
+  switch (font) {
+    case 2: return 2 * textSize;
+    case 4: return 3 * textSize;
+    case 6:
+    case 7: return 6 * textSize;
+    case 8: return 9 * textSize;
+  }
+  return textSize;
+}
+
+int16_t TFT_eSPI::textWidth(const char* text, uint8_t font) {
+  return strlen(text) * 6 * fontScale(font);
+}
+
+int16_t TFT_eSPI::fontHeight(int16_t font) {
+  if (font == 1 && freeFont != NULL)
+    return freeFont->yAdvance * textSize;
+  switch (font) {
+    case 2: return 16 * textSize;
+    case 4: return 26 * textSize;
+    case 6:
+    case 7: return 48 * textSize;
+    case 8: return 75 * textSize;
+  }
+  return 8 * textSize;
+}
+
+int16_t TFT_eSPI::drawString(const char* text, int32_t x, int32_t y, uint8_t font) {
+  uint8_t scale = fontScale(font);
+  int16_t width = textWidth(text, font);
+  int16_t height = fontHeight(font);
+  bool fillBg = (textBgColor != textColor && !(font == 1 && freeFont != NULL));
+
+  x -= (textDatum % 3) * width / 2;
+  y -= (textDatum / 3) * height / 2;
+
+  for (const char* c = text; *c; c++, x += 6 * scale) {
+    if (fillBg)
+      fillRect(x, y, 6 * scale, height, textBgColor);
+    if (*c < 0x20 || *c > 0x7E)
+      continue;
+    const uint8_t* glyph = &glcdFont[(*c - 0x20) * 5];
+    for (int32_t col = 0; col < 5; col++)
+      for (int32_t row = 0; row < 8; row++)
+        if (glyph[col] & (1 << row))
+          fillRect(x + col * scale, y + row * scale, scale, scale, textColor);
+  }
+
+  return width;
+}
+
+/**
+  Sprite
+*/
+TFT_eSprite::TFT_eSprite(TFT_eSPI* tft) : TFT_eSPI(0, 0) {
+  this->tft = tft;
+}
+
+void* TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames) {
+  _width = w;
+  _height = h;
+  buffer.assign(w * h, 0);
+  resetViewport();
+  return buffer.data();
+}
+
+void TFT_eSprite::deleteSprite() {
+  buffer.clear();
+  _width = _height = 0;
+  resetViewport();
+}
+
+void TFT_eSprite::writePixel(int32_t x, int32_t y, uint16_t color) {
+  buffer[y * _width + x] = (colorDepth == 1) ? (color != 0) : color;
+}
+
+uint16_t TFT_eSprite::getPixel(int32_t x, int32_t y) {
+  uint16_t color = buffer[y * _width + x];
+  if (colorDepth == 1)
+    return (color) ? bitmapFg : bitmapBg;
+  return color;
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+  for (int32_t j = 0; j < _height; j++)
+    for (int32_t i = 0; i < _width; i++)
+      tft->drawPixel(x + i, y + j, getPixel(i, j));
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y, uint16_t transparent) {
+  for (int32_t j = 0; j < _height; j++)
+    for (int32_t i = 0; i < _width; i++)
+      if (getPixel(i, j) != transparent)
+        tft->drawPixel(x + i, y + j, getPixel(i, j));
+}
+
+bool TFT_eSprite::pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh) {
+  if (sx < 0 || sy < 0 || sx + sw > _width || sy + sh > _height)
+    return false;
+  for (int32_t j = 0; j < sh; j++)
+    for (int32_t i = 0; i < sw; i++)
+      tft->drawPixel(tx + i, ty + j, getPixel(sx + i, sy + j));
+  return true;
+}
@@ -0,0 +1,112 @@
+#ifndef TFT_ESPI_H
+#define TFT_ESPI_H
+
+// Host shim of TFT_eSPI drawing into RAM framebuffers (golden image tests)
+// Every font is the 5x7 GLCD font scaled to the height of the real font, 8bpp sprites keep 16bpp colors
+
+#include <Arduino.h>
+#include <vector>
+
+// Backlight pin of user setup (TTGO T4)
+#ifndef TFT_BL
+#define TFT_BL 4
+#endif
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define MC_DATUM 4
+#define MR_DATUM 5
+#define BL_DATUM 6
+#define BC_DATUM 7
+#define BR_DATUM 8
+
+typedef struct {
+  uint8_t yAdvance;
+} GFXfont;
+
+extern const GFXfont Roboto_Thin_24;
+extern const GFXfont Orbitron_Light_24;
+extern const GFXfont Orbitron_Light_32;
+
+class TFT_eSPI {
+  public:
+    TFT_eSPI(int16_t w = 240, int16_t h = 320);
+    virtual ~TFT_eSPI() {}
+    void begin() {}
+    void invertDisplay(bool invert) {}
+    void setRotation(uint8_t r);
+    uint8_t getRotation() { return rotation; }
+    int16_t width() { return _width; }
+    int16_t height() { return _height; }
+    // Text
+    void setTextDatum(uint8_t datum) { textDatum = datum; }
+    uint8_t getTextDatum() { return textDatum; }
+    void setTextColor(uint16_t color) { textColor = textBgColor = color; }
+    void setTextColor(uint16_t color, uint16_t bgColor) { textColor = color; textBgColor = bgColor; }
+    void setTextSize(uint8_t size) { textSize = (size == 0) ? 1 : size; }
+    void setFreeFont(const GFXfont* font) { textFont = 1; freeFont = font; }
+    int16_t drawString(const char* text, int32_t x, int32_t y, uint8_t font);
+    int16_t drawString(const String& text, int32_t x, int32_t y, uint8_t font) { return drawString(text.c_str(), x, y, font); }
+    int16_t drawString(const char* text, int32_t x, int32_t y) { return drawString(text, x, y, textFont); }
+    int16_t textWidth(const char* text, uint8_t font);
+    int16_t textWidth(const char* text) { return textWidth(text, textFont); }
+    int16_t fontHeight(int16_t font);
+    int16_t fontHeight() { return fontHeight(textFont); }
+    // Graphics
+    virtual void drawPixel(int32_t x, int32_t y, uint32_t color);
+    void fillScreen(uint32_t color) { fillRect(-vpDatumX, -vpDatumY, _width, _height, color); }
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) { fillRect(x, y, 1, h, color); }
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) { fillRect(x, y, w, 1, color); }
+    void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+    void fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color);
+    void fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color);
+    void setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum = true);
+    void resetViewport();
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data);
+    void setSwapBytes(bool swap) {}
+    bool getSwapBytes() { return false; }
+    uint16_t readPixel(int32_t x, int32_t y);
+    // Host only - RGB565 pixels of panel as shown in current rotation
+    void readScreen(std::vector<uint16_t>& pixels);
+  protected:
+    int32_t _width, _height;
+    uint8_t rotation = 0;
+    std::vector<uint16_t> buffer;
+    int32_t vpDatumX = 0, vpDatumY = 0;
+    int32_t clipX1 = 0, clipY1 = 0, clipX2, clipY2;
+    uint8_t textDatum = TL_DATUM;
+    uint16_t textColor = 0xFFFF, textBgColor = 0xFFFF;
+    uint8_t textSize = 1;
+    uint8_t textFont = 1;
+    const GFXfont* freeFont = NULL;
+    uint8_t fontScale(uint8_t font);
+    virtual void writePixel(int32_t x, int32_t y, uint16_t color);
+    virtual uint16_t getPixel(int32_t x, int32_t y);
+};
+
+class TFT_eSprite : public TFT_eSPI {
+  public:
+    TFT_eSprite(TFT_eSPI* tft);
+    void* createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+    void deleteSprite();
+    bool created() { return !buffer.empty(); }
+    void setColorDepth(int8_t depth) { colorDepth = depth; }
+    int8_t getColorDepth() { return colorDepth; }
+    void setBitmapColor(uint16_t fg, uint16_t bg) { bitmapFg = fg; bitmapBg = bg; }
+    void fillSprite(uint32_t color) { fillScreen(color); }
+    void pushSprite(int32_t x, int32_t y);
+    void pushSprite(int32_t x, int32_t y, uint16_t transparent);
+    bool pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh);
+    void* getPointer() { return buffer.data(); }
+  protected:
+    TFT_eSPI* tft;
+    int8_t colorDepth = 16;
+    uint16_t bitmapFg = 0xFFFF, bitmapBg = 0x0000;
+    void writePixel(int32_t x, int32_t y, uint16_t color) override;
+    uint16_t getPixel(int32_t x, int32_t y) override;
+};
+
+#endif // TFT_ESPI_H
@@ -0,0 +1,5 @@
+#ifndef ANALOGWRITE_H
+#define ANALOGWRITE_H
+#include <stdint.h>
+void analogWrite(uint8_t pin, int value);
+#endif // ANALOGWRITE_H
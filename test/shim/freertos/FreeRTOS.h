@@ -0,0 +1,15 @@
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#include <stdint.h>
+
+typedef void* TaskHandle_t;
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+
+#define portMAX_DELAY 0xffffffff
+#define pdTRUE 1
+#define pdMS_TO_TICKS(x) (x)
+#define configMAX_PRIORITIES 25
+
+#endif // FREERTOS_H
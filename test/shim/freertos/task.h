@@ -0,0 +1,12 @@
+#ifndef TASK_H
+#define TASK_H
+
+#include "FreeRTOS.h"
+
+// Tasks are not started on host, tests call task bodies directly
+inline BaseType_t xTaskCreatePinnedToCore(void (*task)(void*), const char* name, uint32_t stack, void* param, int priority, TaskHandle_t* handle, int core) { return pdTRUE; }
+inline uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks) { return 0; }
+inline void xTaskNotifyGive(TaskHandle_t task) {}
+inline void vTaskDelay(TickType_t ticks) {}
+
+#endif // TASK_H
@@ -0,0 +1,37 @@
+#ifndef TEST_H
+#define TEST_H
+
+// Minimal assertions of host tests, main() returns failures count
+
+#include <stdio.h>
+
+static int testFailures = 0;
+
+#define CHECK(cond) \
+  do { \
+    if (!(cond)) { \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+      testFailures++; \
+    } \
+  } while (0)
+
+#define CHECK_EQ(a, b) \
+  do { \
+    if (!((a) == (b))) { \
+      printf("%s:%d: CHECK_EQ(%s, %s) failed\n", __FILE__, __LINE__, #a, #b); \
+      testFailures++; \
+    } \
+  } while (0)
+
+#define CHECK_STR(a, b) \
+  do { \
+    if (strcmp((a), (b)) != 0) { \
+      printf("%s:%d: CHECK_STR(%s, %s) failed: \"%s\" != \"%s\"\n", __FILE__, __LINE__, #a, #b, (a), (b)); \
+      testFailures++; \
+    } \
+  } while (0)
+
+#define TEST_RESULT(name) \
+  (printf("%s: %s\n", name, (testFailures == 0) ? "OK" : "FAILED"), (testFailures == 0) ? 0 : 1)
+
+#endif // TEST_H
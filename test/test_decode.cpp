@@ -0,0 +1,120 @@
+// Signal table decoder against formulas of string parser (hexToDec/strtol of merged response substrings)
+// Each car parses its loadTestData responses, every directly decoded value is compared with legacy formula
+// Derived values (power, min/max) and aircon coolant temps (no test data) are not listed
+// Negative responses (7F) are skipped, legacy parser decoded them as zeros, signal tables ignore them
+
+#include <Arduino.h>
+#include "test.h"
+#include "../LiveData.h"
+#include "../CarInterface.h"
+#include "../CarKiaEniro.h"
+#include "../CarHyundaiIoniq.h"
+#include "../CarKiaDebugObd2.h"
+#include "legacy_rows.h"
+
+/**
+  Car parsing loadTestData responses, legacy formulas are checked after each response
+*/
+template <class Car> class CheckedCar : public Car {
+  public:
+    const char* name;
+    const LEGACY_ROW* rows;
+    uint16_t rowsCount;
+    uint16_t rowChecks[64] = {0};
+    uint16_t responses = 0;
+    uint32_t values = 0;
+
+    CheckedCar(const char* pName, const LEGACY_ROW* pRows, uint16_t pRowsCount) : name(pName), rows(pRows), rowsCount(pRowsCount) {}
+
+    void parseRowMerged() override {
+
+      Car::parseRowMerged();
+      this->responses++;
+
+      String merged = this->liveData->responseRowMerged;
+      if (merged.substring(0, 2) == "7F")
+        return;
+      for (uint16_t i = 0; i < this->rowsCount; i++) {
+        const LEGACY_ROW* row = &this->rows[i];
+        if (!this->liveData->currentAtshRequest.equals(row->atsh) || strcasecmp(this->liveData->commandRequest.c_str(), row->command) != 0)
+          continue;
+        if (row->matchFrom != -1 && merged.substring(row->matchFrom, row->matchFrom + 2) != row->matchHex)
+          continue;
+        this->rowChecks[i]++;
+        for (uint8_t j = 0; j < row->count; j++) {
+          uint16_t from = row->from + j * (row->to - row->from);
+          float expected = legacyHexToDec(merged.substring(from, from + (row->to - row->from)), row->bytes, row->signedNum) * row->scale + row->valueOffset;
+          float actual = ((float*)((uint8_t*)&this->liveData->params + row->dest))[j];
+          this->values++;
+          if (fabs(actual - expected) > 1e-4 * std::max(1.0f, fabsf(expected))) {
+            printf("%s %s %s row %u[%u]: %f, legacy %f\n", this->name, row->atsh, row->command, i, j, actual, expected);
+            testFailures++;
+          }
+        }
+      }
+    }
+
+    void check() {
+
+      LiveData* liveData = new LiveData();
+      liveData->initParams();
+      this->setLiveData(liveData);
+      this->activateCommandQueue();
+      this->loadTestData();
+
+      // Every legacy formula must be covered by test data
+      for (uint16_t i = 0; i < this->rowsCount; i++) {
+        if (this->rowChecks[i] == 0) {
+          printf("%s %s %s row %u: not in test data\n", this->name, this->rows[i].atsh, this->rows[i].command, i);
+          testFailures++;
+        }
+      }
+      printf("%s: %u responses, %u values compared\n", this->name, this->responses, this->values);
+    }
+};
+
+/**
+  More commands than index slots, setSignals fails, lookups end (no endless probing of full index)
+*/
+static void testSignalIndexFull() {
+
+  static SIGNAL_DEF rows[SIGNAL_INDEX_SIZE + 1];
+  LiveData* liveData = new LiveData();
+  liveData->initParams();
+  CarInterface* car = new CarInterface();
+  car->setLiveData(liveData);
+
+  for (uint16_t i = 0; i < SIGNAL_INDEX_SIZE + 1; i++)
+    rows[i] = { COMMAND_KEY(0x7E4, 0x220100 + i), PARAM(socPerc), 3, 1, false, 1, 0, 1, SIGNAL_MATCH_ANY, 0 };
+  CHECK(!car->setSignals(rows, SIGNAL_INDEX_SIZE + 1));
+
+  // Indexed command is decoded
+  liveData->setResponseMerged("62010032");
+  strlcpy(liveData->responseRequest, "220100", COMMAND_REQUEST_SIZE);
+  liveData->commandKey = COMMAND_KEY(0x7E4, 0x220100);
+  liveData->decodeResponse();
+  CHECK(car->decodeSignals());
+  CHECK_EQ(liveData->params.socPerc, 0x32);
+
+  // Command not in index
+  liveData->params.socPerc = 0;
+  liveData->setResponseMerged("62014032");
+  strlcpy(liveData->responseRequest, "220140", COMMAND_REQUEST_SIZE);
+  liveData->commandKey = COMMAND_KEY(0x7E4, 0x220140);
+  liveData->decodeResponse();
+  CHECK(car->decodeSignals());
+  CHECK_EQ(liveData->params.socPerc, 0);
+
+  CHECK(car->setSignals(rows, SIGNAL_INDEX_SIZE));
+}
+
+int main() {
+
+  CheckedCar<CarKiaEniro>("CarKiaEniro", legacyKiaENiro, sizeof(legacyKiaENiro) / sizeof(LEGACY_ROW)).check();
+  CheckedCar<CarHyundaiIoniq>("CarHyundaiIoniq", legacyHyundaiIoniq, sizeof(legacyHyundaiIoniq) / sizeof(LEGACY_ROW)).check();
+  CheckedCar<CarKiaDebugObd2>("CarKiaDebugObd2", legacyKiaDebugObd2, sizeof(legacyKiaDebugObd2) / sizeof(LEGACY_ROW)).check();
+
+  testSignalIndexFull();
+
+  return TEST_RESULT("test_decode");
+}
@@ -0,0 +1,127 @@
+// formatNumber - explicit cases, sweep against snprintf("%.*f") and buffer bounds
+
+#include <Arduino.h>
+#include "test.h"
+#define private public
+#include "../BoardTtgoT4v13.h"
+#undef private
+
+#define SWEEP_VALUES 2000000
+
+static BoardTtgoT4v13* board;
+
+static const char* format(float value, uint8_t decimals, const char* prefix = "", const char* suffix = "", uint8_t intDigits = 1) {
+
+  static char buf[32];
+  board->formatNumber(buf, value, decimals, prefix, suffix, intDigits);
+  return buf;
+}
+
+static void testCases() {
+
+  // Negatives, sign of value rounded to zero is kept as printf
+  CHECK_STR(format(-1.8, 1), "-1.8");
+  CHECK_STR(format(-24, 0), "-24");
+  CHECK_STR(format(-0.5, 2), "-0.50");
+  CHECK_STR(format(-0.04, 1), "-0.0");
+  CHECK_STR(format(-0.4, 0), "-0");
+  CHECK_STR(format(-0.0, 0), "-0");
+  // Half to even as printf (exact binary halves)
+  CHECK_STR(format(0.5, 0), "0");
+  CHECK_STR(format(1.5, 0), "2");
+  CHECK_STR(format(2.5, 0), "2");
+  CHECK_STR(format(-2.5, 0), "-2");
+  CHECK_STR(format(-3.5, 0), "-4");
+  CHECK_STR(format(0.125, 2), "0.12");
+  CHECK_STR(format(0.375, 2), "0.38");
+  CHECK_STR(format(0.0625, 3), "0.062");
+  // Not exact halves round to nearest
+  CHECK_STR(format(2.51, 0), "3");
+  CHECK_STR(format(0.15, 1), "0.2"); // 0.1500000060
+  CHECK_STR(format(0.35, 1), "0.3"); // 0.3499999940
+  // Zero decimals, decimals over 3 are clamped
+  CHECK_STR(format(0, 0), "0");
+  CHECK_STR(format(94, 0), "94");
+  CHECK_STR(format(999999, 0), "999999");
+  CHECK_STR(format(1.23456, 5), "1.235");
+  CHECK_STR(format(562.7, 1), "562.7");
+  // Prefix, suffix, zero padding (sign is part of width)
+  CHECK_STR(format(5.5, 1, "+", " kWh"), "+5.5 kWh");
+  CHECK_STR(format(5, 0, "", "", 2), "05");
+  CHECK_STR(format(-5, 0, "", "", 3), "-05");
+  CHECK_STR(format(123, 0, "", "", 2), "123");
+  CHECK_STR(format(7.25, 2, "", "", 8), "00000007.25");
+  // Out of range (printf prints all digits)
+  CHECK_STR(format(NAN, 1), "-");
+  CHECK_STR(format(999999.4, 1), "-");
+  CHECK_STR(format(1000000, 0), "-");
+  CHECK_STR(format(-1000000, 0), "-");
+  CHECK_STR(format(1e7, 1), "-");
+  CHECK_STR(format(-1e7, 0, "<", ">"), "<->");
+}
+
+/**
+  Return value is end of string, nothing is written after terminator
+*/
+static void testBuffer() {
+
+  static const float values[] = {0, -0.04, 1.5, -999999, 999999, 123.456, NAN};
+  char buf[32];
+
+  for (float value : values) {
+    for (uint8_t decimals = 0; decimals <= 4; decimals++) {
+      memset(buf, 0xAA, sizeof(buf));
+      char* end = board->formatNumber(buf, value, decimals, "ab", "cd", 8);
+      size_t length = strlen(buf);
+      CHECK(end == buf + length);
+      CHECK(length <= 2 + 1 + 8 + 1 + 3 + 2);
+      for (size_t i = length + 1; i < sizeof(buf); i++)
+        CHECK((uint8_t)buf[i] == 0xAA);
+    }
+  }
+
+  // Longest number
+  CHECK_STR(format(-999999, 3), "-999999.000");
+  CHECK_EQ(strlen(format(-999999, 3)), 11);
+}
+
+/**
+  Random floats of all magnitudes in range and exact halves against snprintf
+*/
+static void testSweep() {
+
+  uint32_t state = 12345;
+  uint32_t mismatches = 0;
+  char expected[32];
+
+  for (uint32_t i = 0; i < SWEEP_VALUES; i++) {
+    state = state * 1103515245 + 12345;
+    uint32_t r = state;
+    state = state * 1103515245 + 12345;
+    float value;
+    if (i & 1)
+      value = (float)(int32_t)(r >> 8) / (float)(1 << ((state >> 16) % 24)); // binary fractions incl. halves
+    else
+      value = ((float)r / 4294967296.0f) * powf(10, (state >> 16) % 7) * (((state >> 8) & 1) ? -1 : 1);
+    if (value > 999999.0 || value < -999999.0)
+      continue;
+    for (uint8_t decimals = 0; decimals <= 3; decimals++) {
+      snprintf(expected, sizeof(expected), "%.*f", decimals, value);
+      if (strcmp(format(value, decimals), expected) != 0) {
+        if (mismatches++ < 10)
+          printf("%.9g decimals %u: \"%s\", printf \"%s\"\n", value, decimals, format(value, decimals), expected);
+      }
+    }
+  }
+  CHECK_EQ(mismatches, 0);
+}
+
+int main() {
+
+  board = new BoardTtgoT4v13();
+  testCases();
+  testBuffer();
+  testSweep();
+
+  return TEST_RESULT("test_format");
+}
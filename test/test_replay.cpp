@@ -0,0 +1,675 @@
+// Adapter replay - ELM327 output is fed through BLE callback and parser of evDash.ino, sent commands are recorded
+
+#include <Arduino.h>
+#include "test.h"
+#include "../evDash.ino"
+#include "../CarInterface.h"
+
+// 220101 of BMS (eNiro test data)
+#define BMS_220101 "620101FFF7E7FFB3000000000300120F9B111011101011000014CC38CB3B00009100003A510000367C000015FB000013D3000690250D018E0000000003E8"
+
+static BLERemoteCharacteristic adapter;
+static char elm[1024];
+
+/**
+  Fresh eNiro with connected adapter
+*/
+static void setupReplay() {
+
+  shimMillis = 1000;
+  liveData = new LiveData();
+  liveData->initParams();
+  board = new BoardTtgoT4v13();
+  board->setLiveData(liveData);
+  board->loadSettings();
+  board->initBoard();
+  car = new CarKiaEniro();
+  car->setLiveData(liveData);
+  car->activateCommandQueue();
+  board->attachCar(car);
+  liveData->pRemoteCharacteristicWrite = &adapter;
+  liveData->bleConnected = true;
+  adapter.written.clear();
+}
+
+/**
+  Index of command in queue (first from loop start)
+*/
+static uint16_t queueIndex(const char* command) {
+
+  for (uint16_t i = liveData->commandQueueLoopFrom; i < liveData->commandQueueCount; i++)
+    if (strncmp(liveData->commandQueue[i], command, strlen(command)) == 0 && liveData->commandQueue[i][strlen(command)] == '\r')
+      return i;
+  return 0;
+}
+
+/**
+  ELM output of ISO-TP response (length line, 0: with 6 bytes, N: with 7 bytes padded by AA), no prompt
+*/
+static const char* elmMultiFrame(const char* merged) {
+
+  size_t length = strlen(merged) / 2;
+  char* out = elm + sprintf(elm, "%03X\r", (unsigned)length);
+
+  for (size_t from = 0, frame = 0; from < length; frame++) {
+    size_t count = (frame == 0) ? 6 : 7;
+    out += sprintf(out, "%X:", (unsigned)(frame % 16));
+    for (size_t i = 0; i < count; i++, from++)
+      out += sprintf(out, "%.2s", (from < length) ? merged + from * 2 : "AA");
+    *out++ = '\r';
+  }
+  *out = 0;
+
+  return elm;
+}
+
+/**
+  Adapter output in BLE notifications of 20 bytes, parser task runs after them
+*/
+static void receive(const char* text) {
+
+  size_t length = strlen(text);
+
+  for (size_t i = 0; i < length; i += 20)
+    notifyCallback(NULL, (uint8_t*)text + i, (length - i < 20) ? length - i : 20, true);
+  processResponse();
+}
+
+/**
+  Prompt of previous command is followed by multi frame response in one notification stream
+  Response is decoded on last frame, prompt only releases next command
+*/
+static void testPromptThenMultiFrame() {
+
+  setupReplay();
+  sendAtCommand(queueIndex("ATSH7E4"), millis());
+  receive("OK\r\r");
+  sendAtCommand(queueIndex("220101"), millis());
+
+  std::string stream = std::string(">") + elmMultiFrame(BMS_220101);
+  receive(stream.c_str());
+
+  CHECK_EQ(liveData->responseExpectedLength, strlen(BMS_220101) / 2);
+  CHECK_EQ(liveData->responseEarlyCompleted, 1);
+  CHECK(liveData->responseCompleted);
+  CHECK(fabs(liveData->params.batVoltage - strtol(String(BMS_220101).substring(30, 34).c_str(), NULL, 16) / 10.0) < 0.01);
+
+  // Prompt after adapter timeout
+  shimMillis += 30;
+  receive("\r>");
+  CHECK(liveData->canSendNextAtCommand);
+  CHECK_EQ(liveData->responseRowLength, 0);
+  CHECK_EQ(liveData->responseRowMergedLength, 0);
+  CHECK_EQ(liveData->responseExpectedLength, 0);
+  CHECK_EQ(liveData->promptLatencyMs, 30);
+  CHECK_EQ(liveData->responseEarlyCompleted, 1);
+}
+
+/**
+  Prompt is never part of next row
+*/
+static void testPromptNotBuffered() {
+
+  setupReplay();
+  sendAtCommand(queueIndex("ATSH7E4"), millis());
+  receive("OK\r\r>");
+  CHECK(liveData->canSendNextAtCommand);
+  CHECK_EQ(liveData->responseRowLength, 0);
+  receive(">OK");
+  CHECK_STR(liveData->responseRow, "OK");
+}
+
+/**
+  Watchdog resends last written command, also adapter setting outside of queue
+*/
+static void testRetryAdapterCommand() {
+
+  setupReplay();
+  sendAtCommand(queueIndex("ATSH7E4"), millis());
+  receive("OK\r\r>");
+  sendAdapterCommand("ATFCSM2\r", COMMAND_TIMEOUT_MS);
+  adapter.written.clear();
+
+  shimMillis += COMMAND_TIMEOUT_MS;
+  commandTimeout(millis());
+  CHECK_EQ(adapter.written, "ATFCSM2\r");
+  CHECK_EQ(liveData->commandRetries, 1);
+  CHECK_EQ(liveData->commandDeadlineMs, millis() + COMMAND_TIMEOUT_MS);
+}
+
+/**
+  Late prompt of first write is not taken as answer of resend
+*/
+static void testStalePrompt() {
+
+  setupReplay();
+  sendAtCommand(queueIndex("ATSH7E4"), millis());
+  receive("OK\r\r>");
+  sendAtCommand(queueIndex("220101"), millis());
+  shimMillis += COMMAND_TIMEOUT_MS;
+  commandTimeout(millis());
+  CHECK_EQ(adapter.written.substr(adapter.written.length() - 14), "220101\r220101\r");
+  CHECK_EQ(liveData->commandPromptsPending, 2);
+
+  // Adapter answers first write late
+  liveData->canSendNextAtCommand = false;
+  receive("NO DATA\r\r>");
+  CHECK(!liveData->canSendNextAtCommand);
+  CHECK_EQ(liveData->commandStalePrompts, 1);
+
+  // Answer of resend
+  receive(elmMultiFrame(BMS_220101));
+  CHECK_EQ(liveData->responseEarlyCompleted, 1);
+  receive("\r>");
+  CHECK(liveData->canSendNextAtCommand);
+  CHECK_EQ(liveData->commandPromptsPending, 0);
+}
+
+/**
+  Prompt of first write lost, single prompt is stale, command is skipped after next deadline
+*/
+static void testLostPromptSkipped() {
+
+  setupReplay();
+  sendAtCommand(queueIndex("ATSH7E4"), millis());
+  receive("OK\r\r>");
+  liveData->commandQueueIndex = queueIndex("220101");
+  doNextAtCommand();
+  shimMillis += COMMAND_TIMEOUT_MS;
+  commandTimeout(millis());
+  liveData->canSendNextAtCommand = false;
+  receive(elmMultiFrame(BMS_220101));
+  receive("\r>");
+  CHECK(!liveData->canSendNextAtCommand);
+  CHECK_EQ(liveData->responseEarlyCompleted, 1);
+
+  adapter.written.clear();
+  shimMillis += COMMAND_TIMEOUT_MS;
+  commandTimeout(millis());
+  CHECK_EQ(liveData->commandSkips, 1);
+  CHECK_EQ(liveData->commandPromptsPending, 2);
+  CHECK(adapter.written.length() > 0 && adapter.written != "220101\r");
+}
+
+/**
+  Late response of skipped command is not decoded as response of next command, its prompt is stale
+*/
+static void testLateResponseAfterSkip() {
+
+  setupReplay();
+  sendAtCommand(queueIndex("ATSH7E4"), millis());
+  receive("OK\r\r>");
+  liveData->commandQueueIndex = queueIndex("220101");
+  doNextAtCommand();
+  shimMillis += COMMAND_TIMEOUT_MS;
+  commandTimeout(millis());
+  shimMillis += COMMAND_TIMEOUT_MS;
+  adapter.written.clear();
+  commandTimeout(millis());
+  CHECK_EQ(liveData->commandSkips, 1);
+  CHECK_EQ(adapter.written, "220102\r");
+
+  // Adapter answers skipped 220101 now
+  liveData->canSendNextAtCommand = false;
+  receive(strcat((char*)elmMultiFrame(BMS_220101), "\r>"));
+  CHECK(!liveData->canSendNextAtCommand);
+  CHECK_EQ(liveData->commandStalePrompts, 1);
+  CHECK_EQ(liveData->responseMismatches, 1);
+  CHECK_EQ(liveData->params.cellVoltage[0], 0);
+  CHECK_EQ(liveData->params.batVoltage, -1);
+
+  // Answer of 220102 releases next command
+  receive("NO DATA\r\r>");
+  CHECK(liveData->canSendNextAtCommand);
+  CHECK_EQ(liveData->commandPromptsPending, 0);
+}
+
+/**
+  Adapter answers command with prompt
+*/
+static void answer(const char* response) {
+
+  CHECK(adapter.written.length() > 0);
+  adapter.written.clear();
+  liveData->canSendNextAtCommand = false;
+  receive(response);
+  CHECK(liveData->canSendNextAtCommand);
+}
+
+/**
+  Fast flow control for BMS header, truncated response falls back to adapter default for this header
+*/
+static void testFlowControlFallback() {
+
+  setupReplay();
+  sendAtCommand(queueIndex("ATSH7E4"), millis());
+  answer("OK\r\r>");
+  CHECK_EQ(liveData->flowControlHeader, 0);
+  CHECK(sendFlowControl());
+  CHECK_EQ(adapter.written, "ATFCSD300000\r");
+  answer("OK\r\r>");
+  CHECK(sendFlowControl());
+  CHECK_EQ(adapter.written, "ATFCSM2\r");
+  answer("OK\r\r>");
+  CHECK(!sendFlowControl());
+
+  // ECU stops after first consecutive frames (block size 0 not supported)
+  sendAtCommand(queueIndex("220101"), millis());
+  char* truncated = (char*)elmMultiFrame(BMS_220101);
+  strcpy(strstr(truncated, "\r4:") + 1, "\r>");
+  answer(truncated);
+  CHECK(liveData->flowControlDisabled[0]);
+  CHECK_EQ(liveData->flowControlFallbacks, 1);
+  CHECK(sendFlowControl());
+  CHECK_EQ(adapter.written, "ATFCSM0\r");
+  answer("OK\r\r>");
+  CHECK(!sendFlowControl());
+
+  // Complete response with adapter default does not count as fallback
+  sendAtCommand(queueIndex("220101"), millis());
+  answer(strcat((char*)elmMultiFrame(BMS_220101), "\r>"));
+  CHECK_EQ(liveData->flowControlFallbacks, 1);
+}
+
+/**
+  Request of adapter command is shown without \r and bounded by request buffer
+*/
+static void testAdapterCommandRequest() {
+
+  setupReplay();
+  sendAdapterCommand("ATFCSM2\r", COMMAND_TIMEOUT_MS);
+  CHECK_STR(liveData->commandRequest.c_str(), "ATFCSM2");
+  CHECK_EQ(adapter.written, "ATFCSM2\r");
+
+  sendAdapterCommand("ATCRA7DF\rATCRA7DF\rATCRA7DF\r", COMMAND_TIMEOUT_MS);
+  CHECK_EQ(liveData->commandRequest.length(), COMMAND_REQUEST_SIZE - 1);
+}
+
+// Broadcast id of test (no verified ids of cars), byte 0 is SOC * 2
+static const uint16_t monitorIdsTest[] = { 0x5A0 };
+static const SIGNAL_DEF monitorSignalsTest[] = {
+  { MONITOR_KEY(0x5A0), PARAM(socPerc), 0, 1, false, 0.5, 0, 1, SIGNAL_MATCH_ANY, 0 },
+};
+
+/**
+  Next adapter command of main loop (periodic, monitor, flow control, queue)
+*/
+static void sendNext() {
+
+  adapter.written.clear();
+  if (!sendPeriodic() && !sendMonitor() && !sendFlowControl())
+    doNextAtCommand();
+}
+
+/**
+  Monitor burst after poll loop for registered id, frames decoded by MONITOR_KEY rows
+  Failed burst (BUFFER FULL, timeout) pauses bursts for backoff, lost prompt of ATMA is stopped by bare \r
+*/
+static void testMonitorBurst() {
+
+  setupReplay();
+  liveData->setMonitorIds(monitorIdsTest, 1);
+  car->setSignals(monitorSignalsTest, 1);
+  liveData->flowControlMode = 0; // adapter default after init commands
+  liveData->commandQueueIndex = liveData->commandQueueCount;
+  sendNext();
+  CHECK_EQ(liveData->monitorStep, MONITOR_STEP_CAF_OFF);
+  answer("NO DATA\r\r>");
+
+  sendNext();
+  CHECK_EQ(adapter.written, "ATCAF0\r");
+  answer("OK\r\r>");
+  sendNext();
+  CHECK_EQ(adapter.written, "ATCRA5A0\r");
+  answer("OK\r\r>");
+  sendNext();
+  CHECK_EQ(adapter.written, "ATMA\r");
+  CHECK(liveData->monitorActive);
+  CHECK_EQ(liveData->commandDeadlineMs, millis() + COMMAND_TIMEOUT_MS + MONITOR_WINDOW_MS);
+  receive("B4\rC80102\r");
+  CHECK_EQ(liveData->monitorFrames, 2);
+  CHECK_EQ(liveData->params.socPerc, 100);
+  // Window end, character stops ATMA
+  answer("STOPPED\r\r>");
+  CHECK(!liveData->monitorActive);
+  sendNext();
+  CHECK_EQ(adapter.written, "ATAR\r");
+  answer("OK\r\r>");
+  sendNext();
+  CHECK_EQ(adapter.written, "ATCAF1\r");
+  answer("OK\r\r>");
+  CHECK_EQ(liveData->monitorStep, MONITOR_STEP_IDLE);
+  sendNext();
+  CHECK(strncmp(adapter.written.c_str(), "AT", 2) != 0 || adapter.written == liveData->commandQueue[liveData->commandQueueIndex - 1]);
+
+  // Adapter overrun, polling only until backoff elapsed
+  liveData->commandQueueIndex = liveData->commandQueueCount;
+  answer("NO DATA\r\r>");
+  sendNext();
+  answer("NO DATA\r\r>");
+  sendNext();
+  answer("OK\r\r>");
+  sendNext();
+  answer("OK\r\r>");
+  sendNext();
+  CHECK_EQ(adapter.written, "ATMA\r");
+  receive("C8\rBUFFER FULL\r");
+  CHECK(liveData->monitorOverrun);
+  CHECK_EQ(liveData->monitorFrames, 3);
+  answer("\r>");
+  sendNext();
+  CHECK_EQ(adapter.written, "ATAR\r");
+  answer("OK\r\r>");
+  sendNext();
+  CHECK_EQ(adapter.written, "ATCAF1\r");
+  answer("OK\r\r>");
+  CHECK_EQ(liveData->monitorFailures, 1);
+  CHECK_EQ(liveData->monitorRetryMs, millis() + MONITOR_BACKOFF_MS);
+  liveData->commandQueueIndex = liveData->commandQueueCount;
+  sendNext();
+  CHECK_EQ(liveData->monitorStep, MONITOR_STEP_IDLE);
+  answer("NO DATA\r\r>");
+
+  // Backoff elapsed, prompt of ATMA lost: \r stops monitor before ATAR, second failure doubles backoff
+  shimMillis += MONITOR_BACKOFF_MS;
+  liveData->commandQueueIndex = liveData->commandQueueCount;
+  sendNext();
+  CHECK_EQ(liveData->monitorStep, MONITOR_STEP_CAF_OFF);
+  answer("NO DATA\r\r>");
+  sendNext();
+  CHECK_EQ(adapter.written, "ATCAF0\r");
+  CHECK(!liveData->monitorOverrun);
+  answer("OK\r\r>");
+  sendNext();
+  answer("OK\r\r>");
+  sendNext();
+  CHECK_EQ(adapter.written, "ATMA\r");
+  receive("C8\r");
+  shimMillis = liveData->commandDeadlineMs;
+  adapter.written.clear();
+  commandTimeout(millis());
+  CHECK_EQ(adapter.written, "\r");
+  CHECK(liveData->monitorOverrun);
+  answer("STOPPED\r\r>");
+  CHECK(liveData->canSendNextAtCommand);
+  sendNext();
+  CHECK_EQ(adapter.written, "ATAR\r");
+  answer("OK\r\r>");
+  sendNext();
+  CHECK_EQ(adapter.written, "ATCAF1\r");
+  answer("OK\r\r>");
+  CHECK_EQ(liveData->monitorFailures, 2);
+  CHECK_EQ(liveData->monitorRetryMs, millis() + 2 * MONITOR_BACKOFF_MS);
+
+  // Successful burst resets backoff
+  shimMillis += 2 * MONITOR_BACKOFF_MS;
+  liveData->flowControlMode = 0; // unknown after timeout
+  liveData->commandQueueIndex = liveData->commandQueueCount;
+  sendNext();
+  answer("NO DATA\r\r>");
+  for (uint8_t i = 0; i < 4; i++) {
+    sendNext();
+    answer("OK\r\r>");
+  }
+  sendNext();
+  CHECK_EQ(adapter.written, "ATCAF1\r");
+  answer("OK\r\r>");
+  CHECK_EQ(liveData->monitorFailures, 0);
+}
+
+/**
+  Ioniq registers ESC wheel speeds, 14 bit little endian frame decoded by car in monitor mode
+*/
+static void testIoniqWheelSpeed() {
+
+  setupReplay();
+  car = new CarHyundaiIoniq();
+  car->setLiveData(liveData);
+  car->activateCommandQueue();
+  board->attachCar(car);
+  CHECK_EQ(liveData->monitorIdsCount, 1);
+  CHECK_EQ(liveData->monitorIds[0], 0x386);
+
+  // 50 km/h = 1600 (0x0640) on each wheel, alive counter in top 2 bits of odd bytes
+  liveData->monitorIdIndex = 0;
+  liveData->monitorActive = true;
+  receive("4006404640864006\r");
+  liveData->monitorActive = false;
+  CHECK_EQ(liveData->monitorFrames, 1);
+  CHECK(fabs(liveData->params.speedKmh - 50) < 0.01);
+}
+
+// Periodic DIDs of test (no verified DIDs of cars), BMS frames on 7EC
+static const PERIODIC_DID periodicDidsTest[] = {
+  { "ATSH7E4\r", 0x7EC, 0x01, COMMAND_KEY(0x7E4, 0x220101) },
+  { "ATSH7E4\r", 0x7EC, 0x02, COMMAND_KEY(0x7E4, 0x220105) },
+};
+
+/**
+  Periodic frame received in monitor burst of rx id
+*/
+static void receivePeriodicFrame(const char* frame) {
+
+  liveData->monitorIdIndex = 0;
+  liveData->monitorActive = true;
+  receive(frame);
+  liveData->monitorActive = false;
+}
+
+/**
+  Subscription of periodic DIDs, 6A replaces polling, 7F 2A keeps polling, stale stream is polled again
+*/
+static void testPeriodicDids() {
+
+  setupReplay();
+  liveData->flowControlMode = 0; // adapter default after init commands
+  liveData->setPeriodicDids(periodicDidsTest, 2);
+  CHECK_EQ(liveData->monitorIdsCount, 1);
+  CHECK_EQ(liveData->monitorIds[0], 0x7EC);
+  uint16_t polled0101 = queueIndex("220101");
+  uint16_t polled0105 = queueIndex("220105");
+  CHECK(polled0101 != 0 && polled0105 != 0);
+
+  // Positive response, polled command is skipped while frames are received
+  sendNext();
+  CHECK_EQ(adapter.written, "ATSH7E4\r");
+  answer("OK\r\r>");
+  sendNext();
+  CHECK_EQ(adapter.written, "2A0301\r");
+  answer("6A\r\r>");
+  CHECK_EQ(liveData->periodicState[0], PERIODIC_STATE_ACTIVE);
+  CHECK(liveData->commandQueueStreamed[polled0101]);
+  CHECK(!liveData->isCommandDue(polled0101, millis()));
+  CHECK(liveData->adapterAtsh == NULL);
+  sendNext();
+  CHECK_EQ(liveData->periodicStep, PERIODIC_STEP_IDLE);
+  answer("OK\r\r>");
+
+  // Negative response 7F 2A, command stays polled
+  sendNext();
+  CHECK_EQ(adapter.written, "ATSH7E4\r");
+  answer("OK\r\r>");
+  sendNext();
+  CHECK_EQ(adapter.written, "2A0302\r");
+  answer("7F2A31\r\r>");
+  CHECK_EQ(liveData->periodicState[1], PERIODIC_STATE_REJECTED);
+  CHECK_EQ(liveData->periodicFallbacks, 1);
+  CHECK(!liveData->commandQueueStreamed[polled0105]);
+  sendNext();
+  answer("OK\r\r>");
+  sendNext();
+  CHECK(strncmp(adapter.written.c_str(), "2A", 2) != 0);
+
+  // Frames keep stream active
+  shimMillis += PERIODIC_STALE_MS - 1000;
+  receivePeriodicFrame("01AABBCC\r");
+  CHECK_EQ(liveData->monitorFrames, 1);
+  shimMillis += 2000;
+  checkPeriodicStale(millis());
+  CHECK_EQ(liveData->periodicState[0], PERIODIC_STATE_ACTIVE);
+  // Frame of other DID
+  receivePeriodicFrame("02AABBCC\r");
+
+  // Stale subscription, polling again
+  shimMillis += PERIODIC_STALE_MS;
+  checkPeriodicStale(millis());
+  CHECK_EQ(liveData->periodicState[0], PERIODIC_STATE_REJECTED);
+  CHECK(!liveData->commandQueueStreamed[polled0101]);
+  CHECK_EQ(liveData->periodicFallbacks, 2);
+}
+
+/**
+  Frames of other message on poll response id (periodic DID) are dropped by ISO-TP sequence, sequence wraps F -> 0
+*/
+static void testPeriodicFramesDuringPoll() {
+
+  setupReplay();
+  sendAtCommand(queueIndex("ATSH7E4"), millis());
+  answer("OK\r\r>");
+  sendAtCommand(queueIndex("220101"), millis());
+
+  // Length line, first frame and out of sequence frame of other message after 2:
+  std::string stream = elmMultiFrame(BMS_220101);
+  size_t third = stream.find("\r3:") + 1;
+  stream.insert(third, "012\r0:62010AFFFFFF\r5:AAAAAAAAAAAAAA\r");
+  answer((stream + "\r>").c_str());
+  CHECK_EQ(liveData->responseFramesDropped, 3);
+  CHECK_EQ(liveData->responseEarlyCompleted, 1);
+  CHECK(fabs(liveData->params.batVoltage - strtol(String(BMS_220101).substring(30, 34).c_str(), NULL, 16) / 10.0) < 0.01);
+
+  // Frames after complete response, before prompt
+  sendAtCommand(queueIndex("220101"), millis());
+  stream = elmMultiFrame(BMS_220101);
+  answer((stream + "012\r0:62010AFFFFFF\r\r>").c_str());
+  CHECK_EQ(liveData->responseFramesDropped, 5);
+  CHECK_EQ(liveData->responseEarlyCompleted, 2);
+
+  // More than 16 frames
+  std::string merged = std::string(BMS_220101) + BMS_220101 + BMS_220101;
+  sendAtCommand(queueIndex("220101"), millis());
+  liveData->canSendNextAtCommand = false;
+  receive(elmMultiFrame(merged.c_str()));
+  CHECK(liveData->responseCompleted);
+  CHECK_EQ(liveData->responseRowMergedLength / 2, (merged.length() / 2 + 1 + 6) / 7 * 7 - 1); // padded last frame
+  CHECK_EQ(strncmp(liveData->responseRowMerged, merged.c_str(), merged.length()), 0);
+  CHECK_EQ(liveData->responseFramesDropped, 5);
+}
+
+/**
+  Queue without due command sends nothing and idles until earliest refresh, subscription wakes it
+*/
+static void testIdleQueue() {
+
+  setupReplay();
+  liveData->subscribeSignals(0);
+  liveData->flowControlMode = 0; // adapter default after init commands
+  liveData->flowControlHeadersCount = 0;
+  liveData->adapterAtsh = NULL;
+  unsigned long now = millis();
+  for (uint16_t i = liveData->commandQueueLoopFrom; i < liveData->commandQueueCount; i++) {
+    liveData->commandQueueRefreshMs[i] = 2000;
+    liveData->commandQueueLastSentMs[i] = now;
+  }
+  uint16_t earliest = queueIndex("220105");
+  liveData->commandQueueLastSentMs[earliest] = now - 1500;
+  liveData->commandQueueSignals[earliest] = 0;
+  liveData->commandQueueIndex = liveData->commandQueueLoopFrom;
+  liveData->commandDeadlineMs = now - 1;
+
+  sendNext();
+  CHECK(adapter.written.empty());
+  CHECK_EQ(liveData->commandDeadlineMs, 0);
+  CHECK_EQ(liveData->commandQueueIdleMs, now + 500);
+  CHECK_EQ(liveData->commandQueueIdles, 1);
+
+  // Earliest command is sent when due (with its ATSH)
+  shimMillis += 500;
+  sendNext();
+  CHECK_EQ(adapter.written, "ATSH7E4\r");
+  CHECK_EQ(liveData->commandQueueIdleMs, 0);
+  answer("OK\r\r>");
+  sendNext();
+  CHECK_EQ(adapter.written, "220105\r");
+  answer("NO DATA\r\r>");
+  sendNext();
+  CHECK(adapter.written.empty());
+  CHECK_EQ(liveData->commandQueueIdleMs, millis() + COMMAND_IDLE_MAX_MS); // scanned again before next refresh
+
+  // Newly subscribed signals are requested now
+  liveData->subscribeSignals(SIGNAL_ALL);
+  CHECK_EQ(liveData->commandQueueIdleMs, millis());
+}
+
+/**
+  Debug screen gets response and request fixed at send time, not strings of main loop
+*/
+static void testDebugResponse() {
+
+  setupReplay();
+  board->displayScreen = SCREEN_DEBUG;
+  board->debugCommandIndex = queueIndex("220101") + 1;
+  sendAtCommand(queueIndex("ATSH7E4"), millis());
+  answer("OK\r\r>");
+  sendAtCommand(queueIndex("220101"), millis());
+  // Main loop moves on before parser runs
+  liveData->commandRequest = "22B002";
+  answer(strcat((char*)elmMultiFrame(BMS_220101), "\r>"));
+  CHECK(liveData->debugResponseReady);
+  CHECK_EQ(liveData->commandKey, COMMAND_KEY(0x7E4, 0x220101));
+
+  doNextAtCommand();
+  CHECK(!liveData->debugResponseReady);
+  CHECK_STR(board->debugCommandRequest.c_str(), "220101");
+  CHECK_EQ(strncmp(board->debugLastString.c_str(), BMS_220101, strlen(BMS_220101)), 0);
+}
+
+/**
+  Values are published once per poll cycle, not after each response
+*/
+static void testPublishPerCycle() {
+
+  PARAMS_STRUC published;
+
+  setupReplay();
+  liveData->clockTime = 1589011873;
+  sendAtCommand(queueIndex("ATSH7E4"), millis());
+  answer("OK\r\r>");
+  sendAtCommand(queueIndex("220101"), millis());
+  answer(strcat((char*)elmMultiFrame(BMS_220101), "\r>"));
+  CHECK(liveData->params.batVoltage > 0);
+  CHECK_EQ(liveData->params.currentTime, 1589011873);
+  CHECK_EQ(liveData->paramsSeq, 0);
+  CHECK(!liveData->newParamsPublished);
+
+  // Queue wraps, parser publishes before bytes of next command
+  liveData->commandQueueIndex = liveData->commandQueueCount;
+  doNextAtCommand();
+  CHECK(liveData->paramsPublishRequested);
+  answer("NO DATA\r\r>");
+  CHECK_EQ(liveData->paramsSeq, 2);
+  CHECK(liveData->newParamsPublished);
+  liveData->readParams(published);
+  CHECK_EQ(published.batVoltage, liveData->params.batVoltage);
+  CHECK_EQ(published.chargingStartTime, 1589011873);
+}
+
+int main() {
+
+  testPromptThenMultiFrame();
+  testPromptNotBuffered();
+  testRetryAdapterCommand();
+  testStalePrompt();
+  testLostPromptSkipped();
+  testLateResponseAfterSkip();
+  testFlowControlFallback();
+  testAdapterCommandRequest();
+  testMonitorBurst();
+  testIoniqWheelSpeed();
+  testPeriodicDids();
+  testPeriodicFramesDuringPoll();
+  testIdleQueue();
+  testDebugResponse();
+  testPublishPerCycle();
+
+  return TEST_RESULT("test_replay");
+}
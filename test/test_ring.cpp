@@ -0,0 +1,156 @@
+// Response ring buffer - BLE task producer and parser task consumer on two threads
+// Byte stream must arrive in order, without loss or duplication, across many wraps
+// Sent command - main loop writer and parser task reader, copy is never mixed of two commands
+
+#include <Arduino.h>
+#include <atomic>
+#include <thread>
+#include "test.h"
+#include "../LiveData.h"
+
+#define RING_TEST_BYTES 8000000
+#define RING_TEST_CHUNK_MAX 64
+#define COMMAND_TEST_COUNT 2000000
+
+// Expected byte stream (LCG)
+static uint8_t streamByte(uint32_t& state) {
+  state = state * 1103515245 + 12345;
+  return state >> 16;
+}
+
+/**
+  Full ring rejects whole notification, nothing is stored
+*/
+static void testFull() {
+
+  LiveData* liveData = new LiveData();
+  uint8_t data[RESPONSE_RING_SIZE];
+  uint8_t ch;
+
+  for (uint16_t i = 0; i < sizeof(data); i++)
+    data[i] = i;
+  CHECK(!liveData->pushResponseBytes(data, RESPONSE_RING_SIZE));
+  CHECK_EQ(liveData->responseRingOverflows, 1);
+  CHECK(!liveData->popResponseByte(ch));
+
+  CHECK(liveData->pushResponseBytes(data, RESPONSE_RING_SIZE - 10));
+  CHECK(!liveData->pushResponseBytes(data, 10));
+  CHECK_EQ(liveData->responseRingOverflows, 2);
+  CHECK(liveData->pushResponseBytes(data, 9));
+
+  for (uint16_t i = 0; i < RESPONSE_RING_SIZE - 10; i++)
+    CHECK(liveData->popResponseByte(ch) && ch == data[i]);
+  for (uint16_t i = 0; i < 9; i++)
+    CHECK(liveData->popResponseByte(ch) && ch == data[i]);
+  CHECK(!liveData->popResponseByte(ch));
+
+  delete liveData;
+}
+
+/**
+  Concurrent producer (random chunks, retried when ring is full) and consumer
+*/
+static void testThreads() {
+
+  LiveData* liveData = new LiveData();
+  uint32_t rejected = 0;
+  uint32_t errors = 0;
+  size_t received = 0;
+
+  std::thread producer([&]() {
+    uint32_t state = 1, chunkState = 7;
+    uint8_t chunk[RING_TEST_CHUNK_MAX];
+    size_t sent = 0;
+    while (sent < RING_TEST_BYTES) {
+      size_t length = 1 + (streamByte(chunkState) % RING_TEST_CHUNK_MAX);
+      if (length > RING_TEST_BYTES - sent)
+        length = RING_TEST_BYTES - sent;
+      for (size_t i = 0; i < length; i++)
+        chunk[i] = streamByte(state);
+      while (!liveData->pushResponseBytes(chunk, length)) {
+        rejected++;
+        std::this_thread::yield();
+      }
+      sent += length;
+    }
+  });
+
+  std::thread consumer([&]() {
+    uint32_t state = 1;
+    uint8_t ch;
+    while (received < RING_TEST_BYTES) {
+      if (!liveData->popResponseByte(ch)) {
+        std::this_thread::yield();
+        continue;
+      }
+      if (ch != streamByte(state))
+        errors++;
+      received++;
+    }
+  });
+
+  producer.join();
+  consumer.join();
+
+  uint8_t ch;
+  CHECK_EQ(received, RING_TEST_BYTES);
+  CHECK_EQ(errors, 0);
+  CHECK(!liveData->popResponseByte(ch));
+  CHECK_EQ(liveData->responseRingOverflows, rejected);
+  printf("test_ring: %d bytes, %u wraps, %u full ring retries\n", RING_TEST_BYTES, RING_TEST_BYTES / RESPONSE_RING_SIZE, rejected);
+
+  delete liveData;
+}
+
+/**
+  Main loop publishes commands while parser task reads them, request always matches its key
+*/
+static void testCommandThreads() {
+
+  LiveData* liveData = new LiveData();
+  static const char* requests[] = { "220101\r", "22B002\r", "ATFCSD300000\r" };
+  uint32_t errors = 0;
+  uint32_t reads = 0;
+  std::atomic<bool> done(false);
+
+  liveData->initParams();
+  std::thread mainLoop([&]() {
+    for (uint32_t i = 0; i < COMMAND_TEST_COUNT; i++) {
+      const char* request = requests[i % 3];
+      liveData->publishCommand(request, strlen(request), (uint64_t)(i % 3 + 1) << 32 | i, (i & 1) == 1);
+    }
+    done = true;
+  });
+
+  std::thread parser([&]() {
+    while (!done) {
+      liveData->readCommand();
+      uint64_t key = liveData->commandKey;
+      if (key == 0)
+        continue;
+      const char* request = requests[(key >> 32) - 1];
+      if (strncmp(liveData->responseRequest, request, strlen(request) - 1) != 0 || liveData->responseRequest[strlen(request) - 1] != '\0' ||
+          liveData->responseDebug != (((uint32_t)key & 1) == 1))
+        errors++;
+      reads++;
+    }
+  });
+
+  mainLoop.join();
+  parser.join();
+
+  CHECK_EQ(errors, 0);
+  CHECK(reads > 0);
+  printf("test_ring: %u commands, %u parser reads\n", COMMAND_TEST_COUNT, reads);
+
+  delete liveData;
+}
+
+int main() {
+
+  testFull();
+  testThreads();
+  testCommandThreads();
+
+  return TEST_RESULT("test_ring");
+}
@@ -0,0 +1,158 @@
+// Golden images of main scenes rendered through TFT_eSPI framebuffer shim
+// Each scene is rendered by full screen sprite (PSRAM) and by strips, both must match same golden image
+// UPDATE_GOLDEN=1 rewrites golden/*.ppm, mismatching frames are written to out/*.ppm
+
+#include <Arduino.h>
+#include <vector>
+#include "test.h"
+#include "../config.h"
+#include "../LiveData.h"
+#include "../CarKiaEniro.h"
+#define private public
+#include "../BoardTtgoT4v13.h"
+#undef private
+
+#define GOLDEN_DIR "golden/"
+#define OUT_DIR "out/"
+
+static BoardTtgoT4v13* createBoard(bool psram) {
+
+  shimPsram = psram;
+  LiveData* liveData = new LiveData();
+  liveData->initParams();
+  BoardTtgoT4v13* board = new BoardTtgoT4v13();
+  board->setLiveData(liveData);
+  board->loadSettings();
+  board->initBoard();
+  CarKiaEniro* car = new CarKiaEniro();
+  car->setLiveData(liveData);
+  car->activateCommandQueue();
+  board->attachCar(car);
+  liveData->params.chargingStartTime = liveData->params.currentTime = 1589011873;
+  return board;
+}
+
+static bool writePpm(const char* fileName, const std::vector<uint16_t>& pixels, int32_t width, int32_t height) {
+
+  FILE* file = fopen(fileName, "wb");
+  if (file == NULL)
+    return false;
+  fprintf(file, "P6\n%d %d\n255\n", width, height);
+  for (uint16_t color : pixels) {
+    uint8_t rgb[3] = { (uint8_t)((color >> 11) << 3), (uint8_t)(((color >> 5) & 0x3F) << 2), (uint8_t)((color & 0x1F) << 3) };
+    fwrite(rgb, 1, 3, file);
+  }
+  fclose(file);
+  return true;
+}
+
+static bool readPpm(const char* fileName, std::vector<uint16_t>& pixels, int32_t& width, int32_t& height) {
+
+  FILE* file = fopen(fileName, "rb");
+  if (file == NULL)
+    return false;
+  int maxValue;
+  if (fscanf(file, "P6 %d %d %d", &width, &height, &maxValue) != 3 || fgetc(file) == EOF) {
+    fclose(file);
+    return false;
+  }
+  pixels.resize(width * height);
+  for (uint16_t& color : pixels) {
+    uint8_t rgb[3];
+    if (fread(rgb, 1, 3, file) != 3) {
+      fclose(file);
+      return false;
+    }
+    color = ((rgb[0] >> 3) << 11) | ((rgb[1] >> 2) << 5) | (rgb[2] >> 3);
+  }
+  fclose(file);
+  return true;
+}
+
+/**
+  Compare display framebuffer with golden image
+*/
+static void checkGolden(const char* name, BoardTtgoT4v13* board) {
+
+  // Golden images come from full screen mode
+  bool strip = (board->stripLines != 0);
+
+  char fileName[64];
+  std::vector<uint16_t> pixels, golden;
+  int32_t width, height;
+  int32_t diff = 0;
+
+  board->tft.readScreen(pixels);
+  snprintf(fileName, sizeof(fileName), GOLDEN_DIR "%s.ppm", name);
+  if (getenv("UPDATE_GOLDEN") != NULL) {
+    if (!strip)
+      CHECK(writePpm(fileName, pixels, board->tft.width(), board->tft.height()));
+    return;
+  }
+
+  if (!readPpm(fileName, golden, width, height)) {
+    printf("%s: missing golden image %s\n", name, fileName);
+    testFailures++;
+    return;
+  }
+  if (width != board->tft.width() || height != board->tft.height()) {
+    printf("%s: size %dx%d, golden %dx%d\n", name, board->tft.width(), board->tft.height(), width, height);
+    testFailures++;
+    return;
+  }
+  for (size_t i = 0; i < pixels.size(); i++)
+    if (pixels[i] != golden[i])
+      diff++;
+  if (diff != 0) {
+    snprintf(fileName, sizeof(fileName), OUT_DIR "%s%s.ppm", name, (strip) ? "_strip" : "");
+    writePpm(fileName, pixels, width, height);
+    printf("%s%s: %d pixels differ, see %s\n", name, (strip) ? " (strip)" : "", diff, fileName);
+    testFailures++;
+  }
+}
+
+/**
+  Scene with loaded test data, redrawn frames times
+*/
+static void checkScene(const char* name, byte screen, bool hud, uint8_t frames) {
+
+  for (uint8_t psram = 1; psram <= 1; psram--) {
+    BoardTtgoT4v13* board = createBoard(psram);
+    board->displayScreen = screen;
+    board->displayScreenSpeedHud = hud;
+    board->loadTestData();
+    for (uint8_t i = 1; i < frames; i++)
+      board->redrawScreen();
+    checkGolden(name, board);
+  }
+}
+
+/**
+  Menu scrolled to selected item (shown twice, scroll must not move on redraw)
+*/
+static void checkMenu(const char* name, uint16_t selected) {
+
+  for (uint8_t psram = 1; psram <= 1; psram--) {
+    BoardTtgoT4v13* board = createBoard(psram);
+    board->liveData->setMenuCurrent(0);
+    board->liveData->menuItemSelected = selected;
+    board->showMenu();
+    board->showMenu();
+    checkGolden(name, board);
+  }
+}
+
+int main() {
+
+  checkScene("dash", SCREEN_DASH, false, 1);
+  checkScene("speed", SCREEN_SPEED, false, 1);
+  checkScene("speed_hud", SCREEN_SPEED, true, 1);
+  checkScene("cells", SCREEN_CELLS, false, 1);
+  checkScene("charging", SCREEN_CHARGING, false, 1);
+  checkScene("soc10", SCREEN_SOC10, false, 1);
+  checkScene("debug", SCREEN_DEBUG, false, 1);
+  checkScene("debug_2nd", SCREEN_DEBUG, false, 2);
+  checkMenu("menu", 0);
+
+  return TEST_RESULT("test_scenes");
+}